@@ -0,0 +1,343 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Hash.h"
+#include "Lz4.h"
+#include "MappedFile.h"
+
+namespace IMPT {
+
+    /**
+     * @brief Archive - A Folder Packed into a Single Mapped File
+     *
+     * The Header is Followed by an Index of Entries Sorted by Name, then the Names, then the Entry Data,
+     * each Entry Starting on a 64 Byte Boundary. Stored Entries are Read in Place from the Mapping, and
+     * Entries that Shrank Enough when Packed are LZ4 Compressed and Decompressed on Read.
+     */
+    class Archive {
+    public:
+
+        //How the Bytes of an Entry are Stored
+        enum class Codec : uint32_t {
+            Stored = 0,
+            Lz4 = 1
+        };
+
+        //Archive Header Struct is the Start of every .p3dpak File
+        struct Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t entryCount;
+            uint64_t indexOffset;
+            uint64_t namesOffset;
+            uint64_t namesSize;
+        };
+
+        //Archive Entry Struct Locates one Packed File
+        struct Entry {
+            uint64_t offset;
+            uint64_t storedSize;
+            uint64_t size;
+            uint64_t hash;
+            uint32_t nameOffset;
+            uint32_t nameSize;
+            Codec codec;
+            uint32_t reserved;
+        };
+
+        //Version of the Archive Layout, Bumped whenever it Changes
+        static constexpr uint32_t VERSION = 1;
+
+        //Entry Data Starts on this Boundary, so Arrays in it can be Read in Place
+        static constexpr uint64_t ENTRY_ALIGNMENT = 64;
+
+        //An LZ4 Block can't Expand by more than this, so Larger Sizes Mark a Corrupt Index
+        static constexpr uint64_t LZ4_MAX_RATIO = 256;
+
+        //Entries are Compressed Only if it Saves at Least this Fraction of their Size
+        static constexpr uint64_t MIN_SAVING_DIVISOR = 8;
+
+        //Entry Data Holds the Bytes of an Entry, in Place in the Mapping or Decompressed into its own Buffer
+        class EntryData {
+        public:
+            const char* Begin() const { return begin; }
+            const char* End() const { return begin + size; }
+            size_t Size() const { return size; }
+            explicit operator bool() const { return found; }
+
+        private:
+            friend class Archive;
+            const char* begin = nullptr;
+            size_t size = 0;
+            bool found = false;
+            std::unique_ptr<char[]> owned;
+        };
+
+        /**
+         * @brief Archive - Maps an Archive and Checks its Index
+         *
+         * @param Path : The Path of the Archive, a Missing File Leaves the Archive Closed
+         */
+        explicit Archive(const std::string& path) : file(path), path(path) {
+            if (!file.IsOpen())
+                return;
+
+            //Every Entry and Name Must Lie Inside the File, and the Names Must be Sorted for the Lookup
+            const char* begin = file.Begin();
+            uint64_t fileSize = file.Size();
+            if (fileSize < sizeof(Header))
+                throw std::runtime_error("Corrupt archive: " + path);
+            std::memcpy(&header, begin, sizeof(header));
+            if (std::memcmp(header.magic, "P3DPAK", 7) != 0 || header.version != VERSION ||
+                header.indexOffset > fileSize || header.entryCount > (fileSize - header.indexOffset) / sizeof(Entry) ||
+                header.namesOffset > fileSize || header.namesSize > fileSize - header.namesOffset)
+                throw std::runtime_error("Corrupt archive: " + path);
+
+            entries.resize(header.entryCount);
+            if (!entries.empty())
+                std::memcpy(entries.data(), begin + header.indexOffset, entries.size() * sizeof(Entry));
+            names = std::string_view(begin + header.namesOffset, static_cast<size_t>(header.namesSize));
+
+            for (size_t i = 0; i < entries.size(); ++i) {
+                const Entry& entry = entries[i];
+                if (entry.nameOffset > names.size() || entry.nameSize > names.size() - entry.nameOffset ||
+                    entry.offset > fileSize || entry.storedSize > fileSize - entry.offset ||
+                    (entry.codec != Codec::Stored && entry.codec != Codec::Lz4) ||
+                    (entry.codec == Codec::Stored && entry.storedSize != entry.size) ||
+                    (entry.codec == Codec::Lz4 && entry.size / LZ4_MAX_RATIO > entry.storedSize) ||
+                    (i > 0 && !(Name(entries[i - 1]) < Name(entry))))
+                    throw std::runtime_error("Corrupt archive: " + path);
+            }
+            opened = true;
+        }
+
+        Archive(const Archive&) = delete;
+        Archive& operator=(const Archive&) = delete;
+
+        /**
+         * @brief IsOpen - Checks if the Archive Exists and was Mapped
+         *
+         * @return : True if Entries can be Read
+         */
+        bool IsOpen() const {
+            return opened;
+        }
+
+        /**
+         * @brief Path - The Path the Archive was Opened from
+         *
+         * @return : The Path
+         */
+        const std::string& Path() const {
+            return path;
+        }
+
+        /**
+         * @brief Contains - Checks if the Archive has an Entry
+         *
+         * @param Name : The Name of the Entry, Relative to the Packed Folder with '/' Separators
+         * @return : True if the Entry Exists
+         */
+        bool Contains(std::string_view name) const {
+            return Find(name) != nullptr;
+        }
+
+        /**
+         * @brief Read - Reads an Entry, in Place when it is Stored, Safe to Call from any Thread
+         *
+         * @param Name : The Name of the Entry, Relative to the Packed Folder with '/' Separators
+         * @return : The Bytes of the Entry, False if there is no such Entry, Throws if it is Corrupt
+         */
+        EntryData Read(std::string_view name) const {
+            EntryData data;
+            const Entry* entry = Find(name);
+            if (!entry)
+                return data;
+
+            data.found = true;
+            data.size = static_cast<size_t>(entry->size);
+            const char* stored = file.Begin() + entry->offset;
+            if (entry->codec == Codec::Stored) {
+                data.begin = stored;
+                return data;
+            }
+
+            data.owned.reset(new char[data.size]);
+            if (!Lz4Decompress(stored, static_cast<size_t>(entry->storedSize), data.owned.get(), data.size) ||
+                HashBytes(data.owned.get(), data.size) != entry->hash)
+                throw std::runtime_error("Corrupt archive entry: " + path + ":" + std::string(name));
+            data.begin = data.owned.get();
+            return data;
+        }
+
+        /**
+         * @brief Pack - Packs every File of a Folder into an Archive, Failures are Reported and Return False rather than Throw
+         *
+         * Mesh and Texture Caches and Temporary Files are Left Out, they are Rebuilt from the Packed Sources.
+         * A File that can't be Read Stops the Pack, so an Archive is Never Missing a File of its Folder, and
+         * the Previous Archive, if any, is Left in Place.
+         *
+         * @param Folder : The Folder to Pack
+         * @param ArchivePath : The Path of the Archive to Write
+         * @param Compress : Whether Entries that Shrink Enough are LZ4 Compressed
+         * @return : True if the Archive was Written
+         */
+        static bool Pack(const std::string& folder, const std::string& archivePath, bool compress = true) {
+            std::error_code error;
+            std::filesystem::path root(folder);
+            std::filesystem::path archiveFile = std::filesystem::absolute(archivePath, error);
+
+            //Sorted Relative Names, so the Archive is the Same whatever Order the Folder Lists them in
+            std::vector<std::string> fileNames;
+            for (std::filesystem::recursive_directory_iterator it(root, error), end; !error && it != end; it.increment(error)) {
+                if (!it->is_regular_file(error))
+                    continue;
+                std::filesystem::path extension = it->path().extension();
+                if (extension == ".p3dmesh" || extension == ".p3dtex" || extension == ".tmp" || extension == ".p3dpak" ||
+                    std::filesystem::absolute(it->path(), error) == archiveFile)
+                    continue;
+                fileNames.push_back(std::filesystem::relative(it->path(), root, error).generic_string());
+            }
+            if (error) {
+                std::cerr << "Failed to list the folder to pack: " << folder << std::endl;
+                return false;
+            }
+            std::sort(fileNames.begin(), fileNames.end());
+
+            Header packedHeader = {};
+            std::memcpy(packedHeader.magic, "P3DPAK", 7);
+            packedHeader.version = VERSION;
+            packedHeader.entryCount = static_cast<uint32_t>(fileNames.size());
+            packedHeader.indexOffset = sizeof(Header);
+            packedHeader.namesOffset = packedHeader.indexOffset + fileNames.size() * sizeof(Entry);
+
+            std::string nameBlock;
+            for (const std::string& name : fileNames)
+                nameBlock += name;
+            packedHeader.namesSize = nameBlock.size();
+
+            //Entries are Appended as they are Read, the Index is Filled in Along the Way
+            std::vector<Entry> packedEntries(fileNames.size());
+            std::string contents(static_cast<size_t>(packedHeader.namesOffset), '\0');
+            contents += nameBlock;
+
+            uint32_t nameOffset = 0;
+            std::string compressed;
+            for (size_t i = 0; i < fileNames.size(); ++i) {
+                std::string sourcePath = (root / fileNames[i]).string();
+                MappedFile source(sourcePath);
+                if (!source.IsOpen()) {
+                    std::cerr << "Failed to read file to pack: " << sourcePath << std::endl;
+                    return false;
+                }
+
+                Entry& entry = packedEntries[i];
+                entry.nameOffset = nameOffset;
+                entry.nameSize = static_cast<uint32_t>(fileNames[i].size());
+                nameOffset += entry.nameSize;
+                entry.size = source.Size();
+                entry.hash = HashBytes(source.Begin(), source.Size());
+                entry.codec = Codec::Stored;
+
+                const char* bytes = source.Begin();
+                size_t byteCount = source.Size();
+                if (compress && byteCount > 0) {
+                    Lz4Compress(source.Begin(), source.Size(), compressed);
+                    if (compressed.size() <= byteCount - byteCount / MIN_SAVING_DIVISOR) {
+                        entry.codec = Codec::Lz4;
+                        bytes = compressed.data();
+                        byteCount = compressed.size();
+                    }
+                }
+
+                contents.resize(static_cast<size_t>((contents.size() + ENTRY_ALIGNMENT - 1) & ~(ENTRY_ALIGNMENT - 1)), '\0');
+                entry.offset = contents.size();
+                entry.storedSize = byteCount;
+                contents.append(bytes, byteCount);
+            }
+
+            std::memcpy(&contents[0], &packedHeader, sizeof(packedHeader));
+            if (!packedEntries.empty())
+                std::memcpy(&contents[static_cast<size_t>(packedHeader.indexOffset)], packedEntries.data(), packedEntries.size() * sizeof(Entry));
+
+            if (!WriteReplacing(archivePath, contents)) {
+                std::cerr << "Failed to write archive: " << archivePath << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief WriteReplacing - Writes a File through a Temporary File, so a Reader Never Sees a Partial File
+         *
+         * Each Write has its own Temporary File, so Writers of the Same File at Once don't Write into each
+         * Other's, and a Single Rename Replaces the File, a Reader Maps either the Old File or the New One.
+         *
+         * @param Path : The Path of the File, whose Folder Must Exist
+         * @param Contents : The Bytes of the File
+         * @return : False if the File couldn't be Written
+         */
+        static bool WriteReplacing(const std::string& path, const std::string& contents) {
+            std::error_code error;
+
+            //The Process ID Keeps Processes Apart, the Count the Threads of this One
+            static std::atomic<uint64_t> writeCount(0);
+#ifdef _WIN32
+            unsigned long processID = GetCurrentProcessId();
+#else
+            unsigned long processID = static_cast<unsigned long>(getpid());
+#endif
+            std::string temporaryPath = path + "." + std::to_string(processID) + "." + std::to_string(writeCount.fetch_add(1)) + ".tmp";
+            {
+                std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+                file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+                if (!file) {
+                    file.close();
+                    std::filesystem::remove(temporaryPath, error);
+                    return false;
+                }
+            }
+
+            //Renaming over the File Replaces it in One Step, there's no Moment without the File
+#ifdef _WIN32
+            bool replaced = MoveFileExW(std::filesystem::path(temporaryPath).c_str(), std::filesystem::path(path).c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            std::filesystem::rename(temporaryPath, path, error);
+            bool replaced = !error;
+#endif
+            if (!replaced)
+                std::filesystem::remove(temporaryPath, error);
+            return replaced;
+        }
+
+    private:
+
+        std::string_view Name(const Entry& entry) const {
+            return names.substr(entry.nameOffset, entry.nameSize);
+        }
+
+        const Entry* Find(std::string_view name) const {
+            auto found = std::lower_bound(entries.begin(), entries.end(), name, [this](const Entry& entry, std::string_view key) {
+                return Name(entry) < key;
+            });
+            return found != entries.end() && Name(*found) == name ? &*found : nullptr;
+        }
+
+        MappedFile file;
+        std::string path;
+        bool opened = false;
+        Header header = {};
+        std::vector<Entry> entries;
+        std::string_view names;
+    };
+}
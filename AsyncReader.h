@@ -0,0 +1,647 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Parallel.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//io_uring is Driven through the Raw System Calls, so no Library is Needed. Defining IMPT_NO_IO_URING Forces the Threaded Reads
+#if defined(__linux__) && !defined(IMPT_NO_IO_URING) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define IMPT_IO_URING 1
+#endif
+#endif
+
+namespace IMPT {
+
+    /**
+     * @brief AsyncReader - Reads Whole Files in the Background and Hands each one to a Task as soon as it Arrives
+     *
+     * Reads are Queued Up Front and Run while the Tasks Parse what has Already Arrived, so Disk Latency Overlaps
+     * the Parsing instead of Adding to it. On Linux the Reads go through an io_uring, Driven by a Single Thread
+     * that Keeps up to QUEUE_DEPTH of them in Flight. Where io_uring is Missing or Disallowed a Few Threads Run
+     * Blocking Reads instead. Tasks Run on a Pool of Worker Threads and may Queue more Reads and Tasks, for Files
+     * whose Names are Only Known once an Earlier File is Parsed. A ParallelFor Called from a Task Spreads over
+     * the Same Workers (TaskPool), so a Large File still Uses the Idle Ones without Starting Threads of its own.
+     */
+    class AsyncReader : public TaskPool {
+    public:
+
+        //File Data Holds the Whole Contents of a File that was Read
+        class FileData {
+        public:
+            const char* Begin() const { return bytes.get(); }
+            const char* End() const { return bytes.get() + size; }
+            size_t Size() const { return size; }
+            const std::string& Path() const { return path; }
+            explicit operator bool() const { return found; }
+
+        private:
+            friend class AsyncReader;
+            std::unique_ptr<char[]> bytes;
+            size_t size = 0;
+            bool found = false;
+            std::string path;
+        };
+
+        //Called with the Data of a File once it is Read, False Data if it couldn't be
+        using ReadCallback = std::function<void(FileData&)>;
+
+        //Reads in Flight at Once on the io_uring
+        static constexpr unsigned QUEUE_DEPTH = 64;
+
+        //Threads Running Blocking Reads when there is no io_uring
+        static constexpr size_t FALLBACK_THREAD_COUNT = 4;
+
+        //Largest Single Read, Larger Files are Read in Several Steps
+        static constexpr size_t MAX_READ_SIZE = size_t(1) << 30;
+
+        /**
+         * @brief AsyncReader - Starts the Reading Thread(s) and the Worker Threads
+         *
+         * @param ThreadCount : The Number of Threads Tasks Run on, Including the One Calling Wait (0 Uses the Hardware Thread Count)
+         */
+        explicit AsyncReader(size_t threadCount = 0) {
+            if (threadCount == 0)
+                threadCount = DefaultThreadCount();
+
+#ifdef IMPT_IO_URING
+            if (ring.Create(QUEUE_DEPTH)) {
+                wakeDescriptor = eventfd(0, EFD_CLOEXEC);
+                if (wakeDescriptor >= 0)
+                    readThreads.emplace_back(&AsyncReader::RingLoop, this);
+                else
+                    ring.Destroy();
+            }
+#endif
+            if (readThreads.empty()) {
+                for (size_t i = 0; i < FALLBACK_THREAD_COUNT; ++i)
+                    readThreads.emplace_back(&AsyncReader::ReadLoop, this);
+            }
+
+            for (size_t i = 1; i < threadCount; ++i)
+                workers.emplace_back(&AsyncReader::WorkLoop, this);
+        }
+
+        ~AsyncReader() {
+            //Queued Work Refers to the Caller's Data, so it is Finished before the Threads Stop
+            std::unique_lock<std::mutex> lock(mutex);
+            Drain(lock);
+            stopping = true;
+            lock.unlock();
+
+            Wake();
+            jobReady.notify_all();
+            for (std::thread& thread : readThreads)
+                thread.join();
+            for (std::thread& thread : workers)
+                thread.join();
+
+#ifdef IMPT_IO_URING
+            if (wakeDescriptor >= 0)
+                close(wakeDescriptor);
+            ring.Destroy();
+#endif
+        }
+
+        AsyncReader(const AsyncReader&) = delete;
+        AsyncReader& operator=(const AsyncReader&) = delete;
+
+        /**
+         * @brief Read - Queues the Read of a Whole File, Safe to Call from any Thread and from Tasks
+         *
+         * @param Path : The Path of the File
+         * @param OnRead : The Task Run on a Worker Thread with the Data once the File is Read
+         * @return : Void
+         */
+        void Read(const std::string& path, ReadCallback onRead) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++outstanding;
+                reads.push_back({ path, std::move(onRead) });
+            }
+            Wake();
+        }
+
+        /**
+         * @brief Run - Queues a Task that Needs no File, Safe to Call from any Thread and from Tasks
+         *
+         * @param Task : The Task Run on a Worker Thread
+         * @return : Void
+         */
+        void Run(std::function<void()> task) override {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++outstanding;
+            jobs.push_back({ [task = std::move(task)](FileData&) { task(); }, FileData() });
+            jobReady.notify_one();
+        }
+
+        /**
+         * @brief ThreadCount - The Number of Threads Tasks Run on, Including the One Calling Wait
+         *
+         * @return : The Number of Threads
+         */
+        size_t ThreadCount() const override {
+            return workers.size() + 1;
+        }
+
+        /**
+         * @brief Wait - Runs Tasks on the Calling Thread until every Read and Task, Including those they Queue, is Done
+         *
+         * @return : Void, the First Exception Thrown by a Task is Rethrown once all are Done
+         */
+        void Wait() {
+            std::unique_lock<std::mutex> lock(mutex);
+            Drain(lock);
+            if (firstError) {
+                std::exception_ptr error = firstError;
+                firstError = nullptr;
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief UsesIoUring - Checks if the Reads go through an io_uring
+         *
+         * @return : False if the Reads Run on Blocking Threads
+         */
+        bool UsesIoUring() const {
+#ifdef IMPT_IO_URING
+            return ring.IsOpen();
+#else
+            return false;
+#endif
+        }
+
+        /**
+         * @brief ReadWholeFile - Reads a File with Blocking Calls
+         *
+         * @param Path : The Path of the File
+         * @return : The Data, False if the File couldn't be Opened or Read
+         */
+        static FileData ReadWholeFile(const std::string& path) {
+            FileData data;
+            data.path = path;
+#ifdef _WIN32
+            HANDLE fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (fileHandle == INVALID_HANDLE_VALUE)
+                return data;
+
+            LARGE_INTEGER fileSize;
+            bool read = GetFileSizeEx(fileHandle, &fileSize) != 0;
+            if (read) {
+                data.size = static_cast<size_t>(fileSize.QuadPart);
+                data.bytes.reset(new char[std::max<size_t>(data.size, 1)]);
+                for (size_t done = 0; read && done < data.size; ) {
+                    DWORD count = 0;
+                    DWORD request = static_cast<DWORD>(std::min(data.size - done, MAX_READ_SIZE));
+                    read = ReadFile(fileHandle, data.bytes.get() + done, request, &count, nullptr) != 0 && count > 0;
+                    done += count;
+                }
+            }
+            CloseHandle(fileHandle);
+            data.found = read;
+#else
+            int fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fileDescriptor < 0)
+                return data;
+
+            struct stat fileStat;
+            bool read = fstat(fileDescriptor, &fileStat) == 0;
+            if (read) {
+                data.size = static_cast<size_t>(fileStat.st_size);
+                data.bytes.reset(new char[std::max<size_t>(data.size, 1)]);
+                for (size_t done = 0; read && done < data.size; ) {
+                    ssize_t count = pread(fileDescriptor, data.bytes.get() + done, std::min(data.size - done, MAX_READ_SIZE), static_cast<off_t>(done));
+                    if (count < 0 && errno == EINTR)
+                        continue;
+                    read = count > 0;
+                    if (read)
+                        done += static_cast<size_t>(count);
+                }
+            }
+            close(fileDescriptor);
+            data.found = read;
+#endif
+            return data;
+        }
+
+    private:
+
+        //A Read Queued but not Started
+        struct PendingRead {
+            std::string path;
+            ReadCallback onRead;
+        };
+
+        //A Task Ready to Run, with the Data of the File it Waited for
+        struct Job {
+            ReadCallback task;
+            FileData data;
+        };
+
+        /**
+         * @brief Drain - Runs Tasks on the Calling Thread until Nothing is Outstanding
+         *
+         * @param Lock : The Held Lock of the Mutex
+         * @return : Void
+         */
+        void Drain(std::unique_lock<std::mutex>& lock) {
+            for (;;) {
+                jobReady.wait(lock, [this]() { return outstanding == 0 || !jobs.empty(); });
+                if (jobs.empty())
+                    return;
+                RunJob(lock);
+            }
+        }
+
+        /**
+         * @brief WorkLoop - Runs Tasks until the Reader Stops
+         *
+         * @return : Void
+         */
+        void WorkLoop() {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                jobReady.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                if (jobs.empty())
+                    return;
+                RunJob(lock);
+            }
+        }
+
+        /**
+         * @brief RunJob - Runs the Next Task without the Lock, Keeping its First Exception
+         *
+         * @param Lock : The Held Lock of the Mutex, with at Least one Task Queued
+         * @return : Void
+         */
+        void RunJob(std::unique_lock<std::mutex>& lock) {
+            Job job = std::move(jobs.front());
+            jobs.pop_front();
+            lock.unlock();
+
+            std::exception_ptr error;
+            try {
+                TaskScope scope(this);
+                job.task(job.data);
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            //The File Data is Freed before the Lock is Taken Again
+            job = Job();
+            lock.lock();
+            if (error && !firstError)
+                firstError = error;
+            if (--outstanding == 0)
+                jobReady.notify_all();
+        }
+
+        /**
+         * @brief Complete - Hands the Data of a Finished Read to its Task
+         *
+         * @param OnRead : The Task of the Read
+         * @param Data : The Data of the File
+         * @return : Void
+         */
+        void Complete(ReadCallback onRead, FileData data) {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.push_back({ std::move(onRead), std::move(data) });
+            jobReady.notify_one();
+        }
+
+        /**
+         * @brief Wake - Tells the Reading Thread(s) there are Queued Reads, or that the Reader Stops
+         *
+         * @return : Void
+         */
+        void Wake() {
+#ifdef IMPT_IO_URING
+            if (ring.IsOpen()) {
+                uint64_t one = 1;
+                while (write(wakeDescriptor, &one, sizeof(one)) < 0 && errno == EINTR) {}
+                return;
+            }
+#endif
+            readReady.notify_all();
+        }
+
+        /**
+         * @brief ReadLoop - Runs Queued Reads with Blocking Calls until the Reader Stops
+         *
+         * @return : Void
+         */
+        void ReadLoop() {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (;;) {
+                readReady.wait(lock, [this]() { return stopping || !reads.empty(); });
+                if (reads.empty())
+                    return;
+                PendingRead read = std::move(reads.front());
+                reads.pop_front();
+                lock.unlock();
+
+                FileData data = ReadWholeFile(read.path);
+                Complete(std::move(read.onRead), std::move(data));
+                lock.lock();
+            }
+        }
+
+#ifdef IMPT_IO_URING
+        //Ring Struct Holds the Submission and Completion Queues Shared with the Kernel
+        struct Ring {
+            int descriptor = -1;
+            void* queueMapping = nullptr;
+            size_t queueMappingSize = 0;
+            void* completionMapping = nullptr;
+            size_t completionMappingSize = 0;
+            io_uring_sqe* entries = nullptr;
+            size_t entriesSize = 0;
+
+            unsigned* submitHead = nullptr;
+            unsigned* submitTail = nullptr;
+            unsigned* submitArray = nullptr;
+            unsigned submitMask = 0;
+            unsigned submitCount = 0;
+            unsigned localTail = 0;
+
+            unsigned* completeHead = nullptr;
+            unsigned* completeTail = nullptr;
+            io_uring_cqe* completions = nullptr;
+            unsigned completeMask = 0;
+
+            bool IsOpen() const {
+                return descriptor >= 0;
+            }
+
+            bool Create(unsigned depth) {
+                io_uring_params params = {};
+                descriptor = static_cast<int>(syscall(__NR_io_uring_setup, depth, &params));
+                if (descriptor < 0)
+                    return false;
+
+                //Older Kernels Map the two Rings Separately
+                queueMappingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+                completionMappingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+                bool singleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+                if (singleMapping)
+                    queueMappingSize = completionMappingSize = std::max(queueMappingSize, completionMappingSize);
+
+                queueMapping = mmap(nullptr, queueMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_SQ_RING);
+                if (queueMapping == MAP_FAILED) {
+                    queueMapping = nullptr;
+                    Destroy();
+                    return false;
+                }
+                if (singleMapping) {
+                    completionMapping = queueMapping;
+                }
+                else {
+                    completionMapping = mmap(nullptr, completionMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_CQ_RING);
+                    if (completionMapping == MAP_FAILED) {
+                        completionMapping = nullptr;
+                        Destroy();
+                        return false;
+                    }
+                }
+                entriesSize = params.sq_entries * sizeof(io_uring_sqe);
+                void* entryMapping = mmap(nullptr, entriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_SQES);
+                if (entryMapping == MAP_FAILED) {
+                    Destroy();
+                    return false;
+                }
+                entries = static_cast<io_uring_sqe*>(entryMapping);
+
+                char* queue = static_cast<char*>(queueMapping);
+                submitHead = reinterpret_cast<unsigned*>(queue + params.sq_off.head);
+                submitTail = reinterpret_cast<unsigned*>(queue + params.sq_off.tail);
+                submitArray = reinterpret_cast<unsigned*>(queue + params.sq_off.array);
+                submitMask = *reinterpret_cast<unsigned*>(queue + params.sq_off.ring_mask);
+                submitCount = params.sq_entries;
+                localTail = *submitTail;
+
+                char* completion = static_cast<char*>(completionMapping);
+                completeHead = reinterpret_cast<unsigned*>(completion + params.cq_off.head);
+                completeTail = reinterpret_cast<unsigned*>(completion + params.cq_off.tail);
+                completions = reinterpret_cast<io_uring_cqe*>(completion + params.cq_off.cqes);
+                completeMask = *reinterpret_cast<unsigned*>(completion + params.cq_off.ring_mask);
+                return true;
+            }
+
+            void Destroy() {
+                if (entries)
+                    munmap(entries, entriesSize);
+                if (completionMapping && completionMapping != queueMapping)
+                    munmap(completionMapping, completionMappingSize);
+                if (queueMapping)
+                    munmap(queueMapping, queueMappingSize);
+                if (descriptor >= 0)
+                    close(descriptor);
+                entries = nullptr;
+                completionMapping = queueMapping = nullptr;
+                descriptor = -1;
+            }
+
+            //Queues a Vectored Read, the Caller Keeps no more Reads in Flight than the Queue Holds
+            void PrepareRead(int fileDescriptor, const iovec* vector, uint64_t offset, uint64_t tag) {
+                unsigned index = localTail & submitMask;
+                io_uring_sqe& entry = entries[index];
+                std::memset(&entry, 0, sizeof(entry));
+                entry.opcode = IORING_OP_READV;
+                entry.fd = fileDescriptor;
+                entry.addr = reinterpret_cast<uint64_t>(vector);
+                entry.len = 1;
+                entry.off = offset;
+                entry.user_data = tag;
+                submitArray[index] = index;
+                ++localTail;
+            }
+
+            //Submits the Queued Reads and Waits for at Least one Completion
+            void SubmitAndWait() {
+                __atomic_store_n(submitTail, localTail, __ATOMIC_RELEASE);
+                unsigned submitting = localTail - __atomic_load_n(submitHead, __ATOMIC_ACQUIRE);
+                long result = syscall(__NR_io_uring_enter, descriptor, submitting, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+                //An Interrupted or Busy Ring Returns to the Loop, Unconsumed Entries go with the Next Call
+                if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                    std::this_thread::yield();
+            }
+
+            bool NextCompletion(io_uring_cqe& completion) {
+                unsigned head = *completeHead;
+                if (head == __atomic_load_n(completeTail, __ATOMIC_ACQUIRE))
+                    return false;
+                completion = completions[head & completeMask];
+                __atomic_store_n(completeHead, head + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+        };
+
+        //A Read in Flight on the Ring, Large Files Take Several Steps
+        struct RingRead {
+            int fileDescriptor = -1;
+            size_t done = 0;
+            iovec vector = {};
+            FileData data;
+            ReadCallback onRead;
+        };
+
+        //Tags the Read that Waits on the Wake Event, Other Tags are Slots of RingReads
+        static constexpr uint64_t WAKE_TAG = ~uint64_t(0);
+
+        /**
+         * @brief RingLoop - Starts Queued Reads on the Ring and Hands Finished ones to their Tasks until the Reader Stops
+         *
+         * One Slot of the Ring is Kept for a Read of the Wake Event, which Completes whenever Reads are Queued.
+         * Files are Opened on this Thread, only the Data Reads go through the Ring.
+         *
+         * @return : Void
+         */
+        void RingLoop() {
+            std::vector<RingRead> slots(ring.submitCount - 1);
+            std::vector<size_t> freeSlots;
+            for (size_t i = slots.size(); i > 0; --i)
+                freeSlots.push_back(i - 1);
+
+            uint64_t wakeCount = 0;
+            iovec wakeVector = { &wakeCount, sizeof(wakeCount) };
+            bool wakeQueued = false;
+
+            auto submitStep = [this](RingRead& read, size_t slot) {
+                read.vector.iov_base = read.data.bytes.get() + read.done;
+                read.vector.iov_len = std::min(read.data.size - read.done, MAX_READ_SIZE);
+                ring.PrepareRead(read.fileDescriptor, &read.vector, read.done, slot);
+            };
+            auto finish = [this, &freeSlots](RingRead& read, size_t slot, bool found) {
+                close(read.fileDescriptor);
+                read.data.found = found;
+                Complete(std::move(read.onRead), std::move(read.data));
+                read = RingRead();
+                freeSlots.push_back(slot);
+            };
+
+            for (;;) {
+                if (!wakeQueued) {
+                    ring.PrepareRead(wakeDescriptor, &wakeVector, 0, WAKE_TAG);
+                    wakeQueued = true;
+                }
+
+                //Takes as many Queued Reads as there are Free Slots
+                std::vector<PendingRead> started;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (stopping && reads.empty() && freeSlots.size() == slots.size())
+                        return;
+                    while (!reads.empty() && started.size() < freeSlots.size()) {
+                        started.push_back(std::move(reads.front()));
+                        reads.pop_front();
+                    }
+                }
+
+                for (PendingRead& pending : started) {
+                    FileData data;
+                    data.path = pending.path;
+                    int fileDescriptor = open(pending.path.c_str(), O_RDONLY | O_CLOEXEC);
+                    struct stat fileStat;
+                    bool opened = fileDescriptor >= 0 && fstat(fileDescriptor, &fileStat) == 0;
+
+                    //Missing and Empty Files Need no Read
+                    if (!opened || fileStat.st_size == 0) {
+                        if (fileDescriptor >= 0)
+                            close(fileDescriptor);
+                        data.found = opened;
+                        data.bytes.reset(new char[1]);
+                        Complete(std::move(pending.onRead), std::move(data));
+                        continue;
+                    }
+
+                    size_t slot = freeSlots.back();
+                    freeSlots.pop_back();
+                    RingRead& read = slots[slot];
+                    read.fileDescriptor = fileDescriptor;
+                    read.data = std::move(data);
+                    read.data.size = static_cast<size_t>(fileStat.st_size);
+                    read.data.bytes.reset(new char[read.data.size]);
+                    read.onRead = std::move(pending.onRead);
+                    submitStep(read, slot);
+                }
+
+                ring.SubmitAndWait();
+
+                io_uring_cqe completion;
+                while (ring.NextCompletion(completion)) {
+                    if (completion.user_data == WAKE_TAG) {
+                        wakeQueued = false;
+                        continue;
+                    }
+
+                    size_t slot = static_cast<size_t>(completion.user_data);
+                    RingRead& read = slots[slot];
+                    if (completion.res == -EINTR || completion.res == -EAGAIN) {
+                        submitStep(read, slot);
+                        continue;
+                    }
+
+                    //A Short Read Continues where it Stopped, an Error or an Early End of File Fails the Read
+                    if (completion.res <= 0) {
+                        finish(read, slot, false);
+                        continue;
+                    }
+                    read.done += static_cast<size_t>(completion.res);
+                    if (read.done < read.data.size)
+                        submitStep(read, slot);
+                    else
+                        finish(read, slot, true);
+                }
+            }
+        }
+
+        Ring ring;
+        int wakeDescriptor = -1;
+#endif
+
+        std::mutex mutex;
+        std::condition_variable jobReady;
+        std::condition_variable readReady;
+        std::deque<PendingRead> reads;
+        std::deque<Job> jobs;
+        size_t outstanding = 0;
+        bool stopping = false;
+        std::exception_ptr firstError;
+        std::vector<std::thread> readThreads;
+        std::vector<std::thread> workers;
+    };
+}
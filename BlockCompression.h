@@ -0,0 +1,540 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "Parallel.h"
+
+namespace IMPT {
+
+    /**
+     * @brief BlockEncoder - Compresses 8 Bit Images into the GPU Block Formats BC1, BC3 and BC7
+     *
+     * Every 4x4 Block is Fitted on its Own: the Endpoints Start at the Extremes of the Block along its Principal
+     * Axis, each Pixel Takes the Palette Entry Closest to it, and the Endpoints are then Refitted to the Chosen
+     * Entries by Least Squares, as many Times as the Quality Asks for. BC1 Stores Opaque Colour in 4 Bits per
+     * Pixel, BC3 Adds an Interpolated Alpha Block, and BC7 Uses its Mode 6 (7 Bit RGBA Endpoints with a Parity
+     * Bit each, 16 Entry Palette) for 8 Bits per Pixel at a much Higher Quality.
+     */
+    class BlockEncoder {
+    public:
+
+        //Format Enum Names the Block Formats, None Keeps Textures Uncompressed
+        enum class Format : uint32_t {
+            None,
+            BC1,
+            BC3,
+            BC7
+        };
+
+        //Quality Enum Trades Encoding Time for Error, Fast Keeps the First Fit, Higher Qualities Refit and Search the BC7 Parity Bits
+        enum class Quality : uint32_t {
+            Fast,
+            Normal,
+            High
+        };
+
+        /**
+         * @brief BlockSize - The Size of an Encoded 4x4 Block
+         *
+         * @param Format : The Block Format
+         * @return : 8 Bytes for BC1, 16 for BC3 and BC7
+         */
+        static size_t BlockSize(Format format) {
+            return format == Format::BC1 ? 8 : 16;
+        }
+
+        /**
+         * @brief EncodedSize - The Size of an Encoded Image
+         *
+         * @param Width : The Width of the Image
+         * @param Height : The Height of the Image
+         * @param Format : The Block Format
+         * @return : The Number of Bytes, Partial Blocks at the Edges Count as Whole
+         */
+        static size_t EncodedSize(int width, int height, Format format) {
+            return static_cast<size_t>((width + 3) / 4) * static_cast<size_t>((height + 3) / 4) * BlockSize(format);
+        }
+
+        /**
+         * @brief EncodeImage - Compresses an Image, Rows of Blocks are Spread across Threads
+         *
+         * @param Pixels : The Pixels, Tightly Packed
+         * @param Width : The Width of the Image
+         * @param Height : The Height of the Image
+         * @param Channels : The Number of Channels, 1 (Luminance), 2 (Luminance, Alpha), 3 (RGB) or 4 (RGBA)
+         * @param Format : The Block Format, BC1 Drops Alpha
+         * @param Quality : The Quality
+         * @param Encoded : Receives EncodedSize Bytes, Blocks in Rows from the Top Left
+         * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count)
+         * @return : Void
+         */
+        static void EncodeImage(const unsigned char* pixels, int width, int height, int channels, Format format, Quality quality,
+            unsigned char* encoded, size_t threadCount = 0) {
+            const size_t blocksWide = static_cast<size_t>((width + 3) / 4);
+            const size_t blocksHigh = static_cast<size_t>((height + 3) / 4);
+            const size_t blockSize = BlockSize(format);
+
+            ParallelFor(blocksHigh, threadCount, [&](size_t by) {
+                unsigned char rgba[64];
+                for (size_t bx = 0; bx < blocksWide; ++bx) {
+                    //Pixels Past the Edge Repeat the Last Row and Column, so they don't Pull the Fit Away
+                    for (int i = 0; i < 16; ++i) {
+                        int x = std::min(static_cast<int>(bx * 4) + (i & 3), width - 1);
+                        int y = std::min(static_cast<int>(by * 4) + (i >> 2), height - 1);
+                        const unsigned char* pixel = pixels + (static_cast<size_t>(y) * width + x) * channels;
+                        bool luminance = channels < 3;
+                        rgba[i * 4 + 0] = pixel[0];
+                        rgba[i * 4 + 1] = luminance ? pixel[0] : pixel[1];
+                        rgba[i * 4 + 2] = luminance ? pixel[0] : pixel[2];
+                        rgba[i * 4 + 3] = channels == 2 ? pixel[1] : channels == 4 ? pixel[3] : 255;
+                    }
+
+                    unsigned char* block = encoded + (by * blocksWide + bx) * blockSize;
+                    if (format == Format::BC1)
+                        EncodeBC1(rgba, quality, block);
+                    else if (format == Format::BC3)
+                        EncodeBC3(rgba, quality, block);
+                    else
+                        EncodeBC7(rgba, quality, block);
+                }
+            });
+        }
+
+        /**
+         * @brief EncodeBC1 - Compresses a Block to BC1, Always in its 4 Colour Mode
+         *
+         * @param Rgba : The 16 Pixels, 4 Bytes each in Rows
+         * @param Quality : The Quality
+         * @param Block : Receives the 8 Bytes
+         * @return : Void
+         */
+        static void EncodeBC1(const unsigned char* rgba, Quality quality, unsigned char* block) {
+            float colors[16][3];
+            for (int i = 0; i < 16; ++i) {
+                for (int c = 0; c < 3; ++c)
+                    colors[i][c] = rgba[i * 4 + c];
+            }
+
+            float start[3], end[3];
+            PrincipalEndpoints<3>(colors, start, end);
+            uint16_t endpoints[2] = { Pack565(start), Pack565(end) };
+            uint32_t indices;
+            float error = FitBC1(colors, endpoints, indices);
+
+            for (int iteration = 0; iteration < RefitCount(quality) && error > 0.0f; ++iteration) {
+                //Palette Weights of the Second Endpoint, per Index
+                static const float WEIGHTS[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+                float weights[16];
+                for (int i = 0; i < 16; ++i)
+                    weights[i] = WEIGHTS[(indices >> (2 * i)) & 3];
+                if (!LeastSquares<3>(colors, weights, start, end))
+                    break;
+
+                uint16_t candidate[2] = { Pack565(start), Pack565(end) };
+                uint32_t candidateIndices;
+                float candidateError = FitBC1(colors, candidate, candidateIndices);
+                if (candidateError >= error)
+                    break;
+                endpoints[0] = candidate[0];
+                endpoints[1] = candidate[1];
+                indices = candidateIndices;
+                error = candidateError;
+            }
+
+            block[0] = static_cast<unsigned char>(endpoints[0]);
+            block[1] = static_cast<unsigned char>(endpoints[0] >> 8);
+            block[2] = static_cast<unsigned char>(endpoints[1]);
+            block[3] = static_cast<unsigned char>(endpoints[1] >> 8);
+            for (int b = 0; b < 4; ++b)
+                block[4 + b] = static_cast<unsigned char>(indices >> (8 * b));
+        }
+
+        /**
+         * @brief EncodeBC3 - Compresses a Block to BC3, an 8 Step Alpha Block then a BC1 Colour Block
+         *
+         * @param Rgba : The 16 Pixels, 4 Bytes each in Rows
+         * @param Quality : The Quality
+         * @param Block : Receives the 16 Bytes
+         * @return : Void
+         */
+        static void EncodeBC3(const unsigned char* rgba, Quality quality, unsigned char* block) {
+            int high = 0;
+            int low = 255;
+            for (int i = 0; i < 16; ++i) {
+                high = std::max<int>(high, rgba[i * 4 + 3]);
+                low = std::min<int>(low, rgba[i * 4 + 3]);
+            }
+
+            //With the First Endpoint Greater the Palette Steps Evenly in 7ths between them, a Flat Block Keeps Index 0
+            uint64_t indices = 0;
+            if (high > low) {
+                for (int i = 0; i < 16; ++i) {
+                    int step = ((rgba[i * 4 + 3] - low) * 14 + (high - low)) / (2 * (high - low));
+                    static const uint64_t ORDER[8] = { 1, 7, 6, 5, 4, 3, 2, 0 };
+                    indices |= ORDER[step] << (3 * i);
+                }
+            }
+            block[0] = static_cast<unsigned char>(high);
+            block[1] = static_cast<unsigned char>(low);
+            for (int b = 0; b < 6; ++b)
+                block[2 + b] = static_cast<unsigned char>(indices >> (8 * b));
+
+            EncodeBC1(rgba, quality, block + 8);
+        }
+
+        /**
+         * @brief EncodeBC7 - Compresses a Block to BC7 Mode 6
+         *
+         * @param Rgba : The 16 Pixels, 4 Bytes each in Rows
+         * @param Quality : The Quality
+         * @param Block : Receives the 16 Bytes
+         * @return : Void
+         */
+        static void EncodeBC7(const unsigned char* rgba, Quality quality, unsigned char* block) {
+            float colors[16][4];
+            for (int i = 0; i < 16; ++i) {
+                for (int c = 0; c < 4; ++c)
+                    colors[i][c] = rgba[i * 4 + c];
+            }
+
+            float start[4], end[4];
+            PrincipalEndpoints<4>(colors, start, end);
+            int endpoints[2][4];
+            unsigned char indices[16] = {};
+            float error = QuantizeBC7(colors, start, end, quality, endpoints, indices);
+
+            for (int iteration = 0; iteration < RefitCount(quality) && error > 0.0f; ++iteration) {
+                float weights[16];
+                for (int i = 0; i < 16; ++i)
+                    weights[i] = BC7_WEIGHTS[indices[i]] / 64.0f;
+                if (!LeastSquares<4>(colors, weights, start, end))
+                    break;
+
+                int candidate[2][4];
+                unsigned char candidateIndices[16] = {};
+                float candidateError = QuantizeBC7(colors, start, end, quality, candidate, candidateIndices);
+                if (candidateError >= error)
+                    break;
+                std::memcpy(endpoints, candidate, sizeof(endpoints));
+                std::memcpy(indices, candidateIndices, sizeof(indices));
+                error = candidateError;
+            }
+
+            //The First Index is Stored with 3 Bits, so the Endpoints are Swapped if it doesn't Fit
+            if (indices[0] & 8) {
+                for (int c = 0; c < 4; ++c)
+                    std::swap(endpoints[0][c], endpoints[1][c]);
+                for (unsigned char& index : indices)
+                    index = static_cast<unsigned char>(15 - index);
+            }
+
+            //Mode Bit, the 7 Bit Endpoints Channel by Channel, the Parity Bits, then the Indices
+            uint64_t bits[2] = { 0, 0 };
+            int position = 0;
+            auto write = [&](uint64_t value, int count) {
+                for (int b = 0; b < count; ++b, ++position)
+                    bits[position >> 6] |= ((value >> b) & 1) << (position & 63);
+            };
+            write(1 << 6, 7);
+            for (int c = 0; c < 4; ++c) {
+                write(endpoints[0][c] >> 1, 7);
+                write(endpoints[1][c] >> 1, 7);
+            }
+            write(endpoints[0][0] & 1, 1);
+            write(endpoints[1][0] & 1, 1);
+            for (int i = 0; i < 16; ++i)
+                write(indices[i], i == 0 ? 3 : 4);
+            for (int b = 0; b < 16; ++b)
+                block[b] = static_cast<unsigned char>(bits[b >> 3] >> (8 * (b & 7)));
+        }
+
+    private:
+
+        //Weights of the Second Endpoint in the 16 Entry BC7 Palette, in 64ths
+        static constexpr int BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+        /**
+         * @brief RefitCount - The Number of Least Squares Refits a Quality Allows
+         *
+         * @param Quality : The Quality
+         * @return : The Number of Refits
+         */
+        static int RefitCount(Quality quality) {
+            return quality == Quality::Fast ? 0 : quality == Quality::Normal ? 1 : 4;
+        }
+
+        /**
+         * @brief PrincipalEndpoints - The Extremes of the Pixels along the Axis they Vary Most
+         *
+         * @param Pixels : The 16 Pixels
+         * @param Start : Receives the Extreme at the Low End of the Axis
+         * @param End : Receives the Extreme at the High End of the Axis
+         * @return : Void
+         */
+        template <int N>
+        static void PrincipalEndpoints(const float (*pixels)[N], float* start, float* end) {
+            float mean[N] = {};
+            for (int i = 0; i < 16; ++i) {
+                for (int c = 0; c < N; ++c)
+                    mean[c] += pixels[i][c] / 16.0f;
+            }
+            float covariance[N][N] = {};
+            for (int i = 0; i < 16; ++i) {
+                for (int a = 0; a < N; ++a) {
+                    for (int b = 0; b < N; ++b)
+                        covariance[a][b] += (pixels[i][a] - mean[a]) * (pixels[i][b] - mean[b]);
+                }
+            }
+
+            //Power Iteration, Started from the Channel that Varies Most
+            float axis[N] = {};
+            int widest = 0;
+            for (int c = 1; c < N; ++c)
+                widest = covariance[c][c] > covariance[widest][widest] ? c : widest;
+            axis[widest] = 1.0f;
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                float next[N] = {};
+                float length = 0.0f;
+                for (int a = 0; a < N; ++a) {
+                    for (int b = 0; b < N; ++b)
+                        next[a] += covariance[a][b] * axis[b];
+                    length = std::max(length, std::fabs(next[a]));
+                }
+                if (length <= 0.0f)
+                    break;
+                for (int c = 0; c < N; ++c)
+                    axis[c] = next[c] / length;
+            }
+
+            float low = 0.0f, high = 0.0f;
+            for (int i = 0; i < 16; ++i) {
+                float t = 0.0f;
+                for (int c = 0; c < N; ++c)
+                    t += (pixels[i][c] - mean[c]) * axis[c];
+                low = std::min(low, t);
+                high = std::max(high, t);
+            }
+            float lengthSquared = 0.0f;
+            for (int c = 0; c < N; ++c)
+                lengthSquared += axis[c] * axis[c];
+            if (lengthSquared > 0.0f) {
+                low /= lengthSquared;
+                high /= lengthSquared;
+            }
+            for (int c = 0; c < N; ++c) {
+                start[c] = std::clamp(mean[c] + low * axis[c], 0.0f, 255.0f);
+                end[c] = std::clamp(mean[c] + high * axis[c], 0.0f, 255.0f);
+            }
+        }
+
+        /**
+         * @brief LeastSquares - Fits the Endpoints to the Pixels for Fixed Palette Weights
+         *
+         * @param Pixels : The 16 Pixels
+         * @param Weights : The Weight of the End Endpoint in the Palette Entry of each Pixel
+         * @param Start : Receives the Start Endpoint
+         * @param End : Receives the End Endpoint
+         * @return : False if all Pixels Use the Same Weight, so the Fit is Undetermined
+         */
+        template <int N>
+        static bool LeastSquares(const float (*pixels)[N], const float* weights, float* start, float* end) {
+            float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+            float ax[N] = {}, bx[N] = {};
+            for (int i = 0; i < 16; ++i) {
+                float b = weights[i];
+                float a = 1.0f - b;
+                aa += a * a;
+                ab += a * b;
+                bb += b * b;
+                for (int c = 0; c < N; ++c) {
+                    ax[c] += a * pixels[i][c];
+                    bx[c] += b * pixels[i][c];
+                }
+            }
+            float determinant = aa * bb - ab * ab;
+            if (std::fabs(determinant) < 1e-6f)
+                return false;
+            for (int c = 0; c < N; ++c) {
+                start[c] = std::clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.0f, 255.0f);
+                end[c] = std::clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.0f, 255.0f);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Pack565 - Rounds a Colour to the 5:6:5 Bits of a BC1 Endpoint
+         *
+         * @param Color : The Colour, 0 to 255 per Channel
+         * @return : The Packed Colour
+         */
+        static uint16_t Pack565(const float* color) {
+            int r = static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f);
+            int g = static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f);
+            int b = static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f);
+            return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+        }
+
+        /**
+         * @brief Unpack565 - Expands a BC1 Endpoint to 8 Bits per Channel
+         *
+         * @param Packed : The Packed Colour
+         * @param Color : Receives the Colour
+         * @return : Void
+         */
+        static void Unpack565(uint16_t packed, int* color) {
+            int r = (packed >> 11) & 31;
+            int g = (packed >> 5) & 63;
+            int b = packed & 31;
+            color[0] = (r << 3) | (r >> 2);
+            color[1] = (g << 2) | (g >> 4);
+            color[2] = (b << 3) | (b >> 2);
+        }
+
+        /**
+         * @brief FitBC1 - Picks the Nearest 4 Colour Palette Entry for each Pixel
+         *
+         * The Greater Endpoint Goes First, as the 4 Colour Mode Requires, and Equal Endpoints Use Index 0 only.
+         *
+         * @param Colors : The 16 Pixels
+         * @param Endpoints : The Packed Endpoints, Reordered in Place
+         * @param Indices : Receives the 2 Bit Indices, Pixel 0 in the Lowest Bits
+         * @return : The Squared Error
+         */
+        static float FitBC1(const float (*colors)[3], uint16_t* endpoints, uint32_t& indices) {
+            if (endpoints[0] < endpoints[1])
+                std::swap(endpoints[0], endpoints[1]);
+
+            int palette[4][3];
+            Unpack565(endpoints[0], palette[0]);
+            Unpack565(endpoints[1], palette[1]);
+            int entries = endpoints[0] == endpoints[1] ? 1 : 4;
+            for (int c = 0; c < 3; ++c) {
+                palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+            }
+
+            indices = 0;
+            float error = 0.0f;
+            for (int i = 0; i < 16; ++i) {
+                float best = FLT_MAX_ERROR;
+                uint32_t bestIndex = 0;
+                for (int e = 0; e < entries; ++e) {
+                    float distance = 0.0f;
+                    for (int c = 0; c < 3; ++c) {
+                        float d = colors[i][c] - palette[e][c];
+                        distance += d * d;
+                    }
+                    if (distance < best) {
+                        best = distance;
+                        bestIndex = static_cast<uint32_t>(e);
+                    }
+                }
+                indices |= bestIndex << (2 * i);
+                error += best;
+            }
+            return error;
+        }
+
+        /**
+         * @brief QuantizeBC7 - Rounds the Endpoints to 7 Bits plus Parity and Picks the Indices
+         *
+         * Higher Qualities Try all Four Parity Bit Pairs, Fast Takes the Parity Nearest each Endpoint.
+         *
+         * @param Colors : The 16 Pixels
+         * @param Start : The Start Endpoint
+         * @param End : The End Endpoint
+         * @param Quality : The Quality
+         * @param Endpoints : Receives the Endpoints as 8 Bit Values, the Lowest Bit being the Parity
+         * @param Indices : Receives the 4 Bit Indices
+         * @return : The Squared Error
+         */
+        static float QuantizeBC7(const float (*colors)[4], const float* start, const float* end, Quality quality,
+            int (*endpoints)[4], unsigned char* indices) {
+            float bestError = FLT_MAX_ERROR;
+            for (int parities = 0; parities < 4; ++parities) {
+                int parity[2] = { parities & 1, parities >> 1 };
+                if (quality == Quality::Fast) {
+                    parity[0] = static_cast<int>(start[0] + 0.5f) & 1;
+                    parity[1] = static_cast<int>(end[0] + 0.5f) & 1;
+                }
+
+                int candidate[2][4];
+                const float* sources[2] = { start, end };
+                for (int e = 0; e < 2; ++e) {
+                    for (int c = 0; c < 4; ++c) {
+                        int value = static_cast<int>((sources[e][c] - parity[e]) / 2.0f + 0.5f);
+                        candidate[e][c] = std::clamp(value, 0, 127) * 2 + parity[e];
+                    }
+                }
+
+                unsigned char candidateIndices[16];
+                float error = FitBC7(colors, candidate, candidateIndices, bestError);
+                if (error < bestError) {
+                    bestError = error;
+                    std::memcpy(endpoints, candidate, sizeof(candidate));
+                    std::memcpy(indices, candidateIndices, sizeof(candidateIndices));
+                }
+                if (quality == Quality::Fast)
+                    break;
+            }
+            return bestError;
+        }
+
+        /**
+         * @brief FitBC7 - Picks the Nearest of the 16 Palette Entries for each Pixel
+         *
+         * The Entry is Guessed by Projecting the Pixel on the Endpoint Line, then it and its Neighbours are Compared.
+         *
+         * @param Colors : The 16 Pixels
+         * @param Endpoints : The Endpoints as 8 Bit Values
+         * @param Indices : Receives the Indices
+         * @param Limit : An Error the Fit Stops at, once it can no Longer Win
+         * @return : The Squared Error
+         */
+        static float FitBC7(const float (*colors)[4], const int (*endpoints)[4], unsigned char* indices, float limit) {
+            int palette[16][4];
+            for (int e = 0; e < 16; ++e) {
+                for (int c = 0; c < 4; ++c)
+                    palette[e][c] = ((64 - BC7_WEIGHTS[e]) * endpoints[0][c] + BC7_WEIGHTS[e] * endpoints[1][c] + 32) >> 6;
+            }
+
+            float direction[4];
+            float lengthSquared = 0.0f;
+            for (int c = 0; c < 4; ++c) {
+                direction[c] = static_cast<float>(endpoints[1][c] - endpoints[0][c]);
+                lengthSquared += direction[c] * direction[c];
+            }
+
+            float error = 0.0f;
+            for (int i = 0; i < 16 && error < limit; ++i) {
+                int guess = 0;
+                if (lengthSquared > 0.0f) {
+                    float t = 0.0f;
+                    for (int c = 0; c < 4; ++c)
+                        t += (colors[i][c] - endpoints[0][c]) * direction[c];
+                    guess = std::clamp(static_cast<int>(t / lengthSquared * 15.0f + 0.5f), 0, 15);
+                }
+
+                float best = FLT_MAX_ERROR;
+                for (int e = std::max(guess - 1, 0); e <= std::min(guess + 1, 15); ++e) {
+                    float distance = 0.0f;
+                    for (int c = 0; c < 4; ++c) {
+                        float d = colors[i][c] - palette[e][c];
+                        distance += d * d;
+                    }
+                    if (distance < best) {
+                        best = distance;
+                        indices[i] = static_cast<unsigned char>(e);
+                    }
+                }
+                error += best;
+            }
+            return error;
+        }
+
+        //Larger than any Block Error
+        static constexpr float FLT_MAX_ERROR = 1e30f;
+    };
+}
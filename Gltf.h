@@ -0,0 +1,300 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include "Json.h"
+#include "MappedFile.h"
+
+namespace IMPT {
+
+    /**
+     * @brief GlbFile - A Mapped glTF 2.0 Binary (.glb)
+     *
+     * The JSON Chunk is Parsed when the File is Opened, while Buffer Views and Accessors are only Views into
+     * the Mapped Binary Chunk, so Reading them Copies Nothing. Only the Embedded Binary Chunk is Supported as
+     * a Buffer, External and Data URI Buffers are Rejected.
+     */
+    class GlbFile {
+    public:
+
+        //Accessor Component Types, the same Values as the Matching GL Enums
+        static constexpr int BYTE = 5120;
+        static constexpr int UNSIGNED_BYTE = 5121;
+        static constexpr int SHORT = 5122;
+        static constexpr int UNSIGNED_SHORT = 5123;
+        static constexpr int UNSIGNED_INT = 5125;
+        static constexpr int FLOAT = 5126;
+
+        //Accessor Struct is a Typed View of Elements in the Binary Chunk
+        struct Accessor {
+            const char* data = nullptr;
+            size_t count = 0;
+            int componentType = 0;
+            int components = 0;
+            bool normalized = false;
+            size_t stride = 0;
+
+            /**
+             * @brief ElementSize - The Size of one Element in Bytes
+             *
+             * @return : The Size
+             */
+            size_t ElementSize() const {
+                return ComponentSize(componentType) * static_cast<size_t>(components);
+            }
+
+            /**
+             * @brief ByteLength - The Bytes Spanned from the First Element to the End of the Last
+             *
+             * @return : The Length
+             */
+            size_t ByteLength() const {
+                return count == 0 ? 0 : (count - 1) * stride + ElementSize();
+            }
+
+            /**
+             * @brief ReadFloat - Reads a Component as a Float, Applying the glTF Normalization Rules
+             *
+             * @param Element : The Index of the Element
+             * @param Component : The Index of the Component in the Element
+             * @return : The Value
+             */
+            float ReadFloat(size_t element, int component) const {
+                const char* source = data + element * stride + static_cast<size_t>(component) * ComponentSize(componentType);
+                switch (componentType) {
+                case FLOAT: { float value; std::memcpy(&value, source, sizeof(value)); return value; }
+                case BYTE: { int8_t value; std::memcpy(&value, source, sizeof(value)); return normalized ? std::max(value / 127.0f, -1.0f) : value; }
+                case UNSIGNED_BYTE: { uint8_t value; std::memcpy(&value, source, sizeof(value)); return normalized ? value / 255.0f : value; }
+                case SHORT: { int16_t value; std::memcpy(&value, source, sizeof(value)); return normalized ? std::max(value / 32767.0f, -1.0f) : value; }
+                case UNSIGNED_SHORT: { uint16_t value; std::memcpy(&value, source, sizeof(value)); return normalized ? value / 65535.0f : value; }
+                default: { uint32_t value; std::memcpy(&value, source, sizeof(value)); return static_cast<float>(value); }
+                }
+            }
+
+            /**
+             * @brief ReadIndex - Reads an Unsigned Integer Element, as Index Accessors Hold
+             *
+             * @param Element : The Index of the Element
+             * @return : The Value
+             */
+            uint32_t ReadIndex(size_t element) const {
+                const char* source = data + element * stride;
+                switch (componentType) {
+                case UNSIGNED_BYTE: { uint8_t value; std::memcpy(&value, source, sizeof(value)); return value; }
+                case UNSIGNED_SHORT: { uint16_t value; std::memcpy(&value, source, sizeof(value)); return value; }
+                default: { uint32_t value; std::memcpy(&value, source, sizeof(value)); return value; }
+                }
+            }
+        };
+
+        /**
+         * @brief GlbFile - Maps a glTF Binary and Parses its JSON Chunk
+         *
+         * @param Path : The Path of the File, Throws if it can't be Read or is not a Valid glTF 2.0 Binary
+         */
+        explicit GlbFile(const std::string& path) : file(path), path(path) {
+            if (!file.IsOpen())
+                throw std::runtime_error("Failed to open glTF file: " + path);
+
+            const char* begin = file.Begin();
+            size_t size = file.Size();
+            if (size < HEADER_SIZE + CHUNK_HEADER_SIZE || ReadU32(begin) != MAGIC)
+                throw std::runtime_error("Not a glTF binary: " + path);
+            if (ReadU32(begin + 4) != 2)
+                throw std::runtime_error("Unsupported glTF version: " + path);
+
+            //The Declared Length can be Shorter than the File, never Longer
+            size_t length = ReadU32(begin + 8);
+            if (length > size)
+                throw std::runtime_error("Truncated glTF binary: " + path);
+
+            //The JSON Chunk Comes First, then an Optional Binary Chunk, Unknown Chunks are Skipped
+            bool hasJson = false;
+            for (size_t offset = HEADER_SIZE; offset + CHUNK_HEADER_SIZE <= length; ) {
+                size_t chunkLength = ReadU32(begin + offset);
+                uint32_t chunkType = ReadU32(begin + offset + 4);
+                const char* chunkData = begin + offset + CHUNK_HEADER_SIZE;
+                if (chunkLength > length - offset - CHUNK_HEADER_SIZE)
+                    throw std::runtime_error("Truncated glTF chunk: " + path);
+
+                if (!hasJson) {
+                    if (chunkType != CHUNK_JSON)
+                        throw std::runtime_error("glTF binary does not start with a JSON chunk: " + path);
+                    json = JsonValue::Parse(chunkData, chunkData + chunkLength);
+                    hasJson = true;
+                }
+                else if (chunkType == CHUNK_BIN && !binary) {
+                    binary = chunkData;
+                    binarySize = chunkLength;
+                }
+
+                //Chunks are Padded to 4 Bytes
+                offset += CHUNK_HEADER_SIZE + ((chunkLength + 3) & ~size_t(3));
+            }
+            if (!hasJson)
+                throw std::runtime_error("glTF binary has no JSON chunk: " + path);
+        }
+
+        GlbFile(const GlbFile&) = delete;
+        GlbFile& operator=(const GlbFile&) = delete;
+
+        /**
+         * @brief Json - The Parsed JSON Chunk
+         *
+         * @return : The Root Object
+         */
+        const JsonValue& Json() const {
+            return json;
+        }
+
+        /**
+         * @brief Path - The Path the File was Opened from
+         *
+         * @return : The Path
+         */
+        const std::string& Path() const {
+            return path;
+        }
+
+        /**
+         * @brief Element - An Element of a Top Level Array of the JSON Chunk, such as "meshes"
+         *
+         * @param Array : The Name of the Array
+         * @param Index : The Index of the Element
+         * @return : The Element, Throws if there is no such Element
+         */
+        const JsonValue& Element(std::string_view array, size_t index) const {
+            const JsonValue* elements = json.Find(array);
+            if (!elements || !elements->IsArray() || index >= elements->Size())
+                throw std::runtime_error("glTF " + std::string(array) + " index out of range: " + path);
+            return elements->At(index);
+        }
+
+        /**
+         * @brief GetBufferView - The Bytes of a Buffer View
+         *
+         * @param Index : The Index of the Buffer View
+         * @return : A View into the Mapped Binary Chunk
+         */
+        std::string_view GetBufferView(size_t index) const {
+            const JsonValue& bufferView = Element("bufferViews", index);
+            if (ReadIndexMember(bufferView, "buffer", 0) != 0 || json.Find("buffers") == nullptr || Element("buffers", 0).Find("uri"))
+                throw std::runtime_error("Only the embedded glTF binary buffer is supported: " + path);
+
+            size_t offset = ReadIndexMember(bufferView, "byteOffset", 0);
+            size_t length = ReadIndexMember(bufferView, "byteLength", SIZE_MAX);
+            if (!binary || offset > binarySize || length > binarySize - offset)
+                throw std::runtime_error("glTF buffer view out of bounds: " + path);
+            return std::string_view(binary + offset, length);
+        }
+
+        /**
+         * @brief GetAccessor - Resolves an Accessor to a View of its Elements
+         *
+         * @param Index : The Index of the Accessor
+         * @return : The Accessor, Throws if it Lies Outside its Buffer View or Uses Unsupported Features
+         */
+        Accessor GetAccessor(size_t index) const {
+            const JsonValue& element = Element("accessors", index);
+            if (element.Find("sparse"))
+                throw std::runtime_error("Sparse glTF accessors are not supported: " + path);
+            const JsonValue* bufferViewIndex = element.Find("bufferView");
+            if (!bufferViewIndex)
+                throw std::runtime_error("glTF accessors without a buffer view are not supported: " + path);
+
+            Accessor accessor;
+            accessor.count = ReadIndexMember(element, "count", SIZE_MAX);
+            accessor.componentType = static_cast<int>(element.NumberOr("componentType", 0));
+            accessor.components = ComponentCount(element.Find("type"));
+            const JsonValue* normalized = element.Find("normalized");
+            accessor.normalized = normalized && normalized->GetType() == JsonValue::Type::Bool && normalized->Bool();
+            if (ComponentSize(accessor.componentType) == 0 || accessor.components == 0)
+                throw std::runtime_error("Unsupported glTF accessor type: " + path);
+
+            size_t bufferViewNumber = ReadIndexMember(element, "bufferView", SIZE_MAX);
+            std::string_view bufferView = GetBufferView(bufferViewNumber);
+            accessor.stride = ReadIndexMember(Element("bufferViews", bufferViewNumber), "byteStride", 0);
+            if (accessor.stride == 0)
+                accessor.stride = accessor.ElementSize();
+
+            //Checks the Last Element Fits without Overflowing the Multiplication
+            size_t offset = ReadIndexMember(element, "byteOffset", 0);
+            if (offset > bufferView.size() || accessor.stride < accessor.ElementSize() ||
+                (accessor.count > 0 && (accessor.count - 1 > (bufferView.size() - offset) / accessor.stride ||
+                    accessor.ByteLength() > bufferView.size() - offset)))
+                throw std::runtime_error("glTF accessor out of bounds: " + path);
+
+            accessor.data = bufferView.data() + offset;
+            return accessor;
+        }
+
+        /**
+         * @brief ComponentSize - The Size of a Component Type in Bytes
+         *
+         * @param ComponentType : The Component Type
+         * @return : The Size, 0 for Unknown Types
+         */
+        static size_t ComponentSize(int componentType) {
+            switch (componentType) {
+            case BYTE: case UNSIGNED_BYTE: return 1;
+            case SHORT: case UNSIGNED_SHORT: return 2;
+            case UNSIGNED_INT: case FLOAT: return 4;
+            default: return 0;
+            }
+        }
+
+        /**
+         * @brief ReadIndexMember - Reads a Member Holding a Non-Negative Integer, such as an Index or a Byte Count
+         *
+         * @param Object : The Object
+         * @param Key : The Name of the Member
+         * @param Fallback : The Value if the Member is Missing, SIZE_MAX Makes it Required
+         * @return : The Value, Throws if it is not a Non-Negative Integer
+         */
+        size_t ReadIndexMember(const JsonValue& object, std::string_view key, size_t fallback) const {
+            const JsonValue* value = object.Find(key);
+            if (!value) {
+                if (fallback == SIZE_MAX)
+                    throw std::runtime_error("glTF " + std::string(key) + " is missing: " + path);
+                return fallback;
+            }
+            double number = value->Number();
+            if (!value->IsNumber() || number < 0.0 || number > 9007199254740992.0 || number != static_cast<double>(static_cast<uint64_t>(number)))
+                throw std::runtime_error("glTF " + std::string(key) + " is not a valid integer: " + path);
+            return static_cast<size_t>(number);
+        }
+
+    private:
+        static constexpr uint32_t MAGIC = 0x46546C67;      //"glTF"
+        static constexpr uint32_t CHUNK_JSON = 0x4E4F534A; //"JSON"
+        static constexpr uint32_t CHUNK_BIN = 0x004E4942;  //"BIN"
+        static constexpr size_t HEADER_SIZE = 12;
+        static constexpr size_t CHUNK_HEADER_SIZE = 8;
+
+        //glTF is Little Endian whatever the Host is
+        static uint32_t ReadU32(const char* source) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(source);
+            return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 | static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+        }
+
+        static int ComponentCount(const JsonValue* type) {
+            if (!type || !type->IsString())
+                return 0;
+            const std::string& name = type->String();
+            if (name == "SCALAR") return 1;
+            if (name == "VEC2") return 2;
+            if (name == "VEC3") return 3;
+            if (name == "VEC4") return 4;
+            return 0;
+        }
+
+        MappedFile file;
+        std::string path;
+        JsonValue json;
+        const char* binary = nullptr;
+        size_t binarySize = 0;
+    };
+}
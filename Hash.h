@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace IMPT {
+
+    /**
+     * @brief HashMix - Mixes two 64 Bit Values into one with a Full 128 Bit Multiplication
+     *
+     * @param A : The First Value
+     * @param B : The Second Value
+     * @return : The Mixed Value
+     */
+    inline uint64_t HashMix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t product = static_cast<__uint128_t>(a) * b;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+        //Portable 64x64 -> 128 Bit Multiplication
+        uint64_t aLow = a & 0xFFFFFFFFull, aHigh = a >> 32;
+        uint64_t bLow = b & 0xFFFFFFFFull, bHigh = b >> 32;
+        uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+        uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFull) + (highLow & 0xFFFFFFFFull);
+        uint64_t low = (lowLow & 0xFFFFFFFFull) | (middle << 32);
+        uint64_t high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+        return low ^ high;
+#endif
+    }
+
+    /**
+     * @brief HashBytes - Computes a Fast, Non-Cryptographic 64 Bit Hash of a Block of Memory
+     *
+     * Four Independent Lanes Consume 32 Bytes per Step, so Hashing Runs Close to Memory Bandwidth.
+     *
+     * @param Data : The Bytes to Hash
+     * @param Size : The Number of Bytes
+     * @param Seed : Value that Changes the Hash of Identical Data
+     * @return : The Hash
+     */
+    inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0) {
+        const uint64_t PRIME0 = 0xA0761D6478BD642Full;
+        const uint64_t PRIME1 = 0xE7037ED1A0B428DBull;
+        const uint64_t PRIME2 = 0x8EBC6AF09C88C6E3ull;
+        const uint64_t PRIME3 = 0x589965CC75374CC3ull;
+
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        auto read64 = [](const unsigned char* p) {
+            uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        };
+
+        uint64_t lanes[4] = { seed ^ PRIME2, seed ^ PRIME3, seed ^ PRIME0, seed ^ PRIME1 };
+        size_t remaining = size;
+        while (remaining >= 32) {
+            lanes[0] = HashMix(read64(bytes) ^ PRIME1, lanes[0] ^ PRIME0);
+            lanes[1] = HashMix(read64(bytes + 8) ^ PRIME2, lanes[1] ^ PRIME1);
+            lanes[2] = HashMix(read64(bytes + 16) ^ PRIME3, lanes[2] ^ PRIME2);
+            lanes[3] = HashMix(read64(bytes + 24) ^ PRIME0, lanes[3] ^ PRIME3);
+            bytes += 32;
+            remaining -= 32;
+        }
+
+        //The Seed is Mixed in Again, the Lanes Cancel it Out when no Block was Hashed
+        uint64_t hash = HashMix(lanes[0] ^ lanes[2], lanes[1] ^ lanes[3] ^ PRIME1 ^ seed);
+        while (remaining >= 8) {
+            hash = HashMix(read64(bytes) ^ PRIME2, hash ^ PRIME0);
+            bytes += 8;
+            remaining -= 8;
+        }
+
+        //Packs the Last Few Bytes into a Single Word
+        uint64_t tail = 0;
+        for (size_t i = 0; i < remaining; ++i)
+            tail |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+
+        return HashMix(hash ^ tail ^ PRIME3, static_cast<uint64_t>(size) ^ PRIME1);
+    }
+}
@@ -1,10 +1,42 @@
+#pragma once
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <climits>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <string_view>
 #include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+#include "Archive.h"
+#include "AsyncReader.h"
+#include "BlockCompression.h"
+#include "Gltf.h"
+#include "Hash.h"
+#include "JpegDecoder.h"
+#include "MappedFile.h"
+#include "MeshCodec.h"
+#include "Meshlets.h"
+#include "Mipmaps.h"
+#include "Parallel.h"
+#include "Simplifier.h"
+#include "TangentSpace.h"
+#include "TextScanner.h"
+#include "VertexCache.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
@@ -20,7 +52,7 @@ namespace IMPT {
             glm::vec3 specular;
             float shininess;
             std::string textureFile;
-            GLuint textureID;
+            GLuint textureID = 0;
         };
 
         //Vertices Struct will be used to Store the Vertexes of the Object
@@ -31,190 +63,3149 @@ namespace IMPT {
             glm::vec3 normal;
         };
 
+        //Lod Struct Describes one Level of Detail, a Range of the Mesh Indices and the Geometric Error it Introduces,
+        //the Range of the Mesh Meshlets its Indices are Split into (None if the Level isn't Clustered), and the Range
+        //of the Mesh Submeshes its Indices are Sorted into (None Draws the Level with the First Material)
+        struct Lod {
+            GLuint indexOffset;
+            GLuint indexCount;
+            float error;
+            GLuint meshletOffset = 0;
+            GLuint meshletCount = 0;
+            GLuint submeshOffset = 0;
+            GLuint submeshCount = 0;
+        };
+
+        //Submesh Struct Describes the Triangles of one Level of Detail that Use one Material, a Range of the Mesh Indices
+        //and the Range of the Mesh Meshlets they are Split into. The Material Indexes the Materials of the Object
+        struct Submesh {
+            GLuint material;
+            GLuint indexOffset;
+            GLuint indexCount;
+            GLuint meshletOffset = 0;
+            GLuint meshletCount = 0;
+        };
+
+        struct MappedMesh;
+
+        //Mesh Struct will be used to Store the Unique Vertices of the Object and the Triangles that Index them,
+        //the Indices of every Level of Detail are Stored one after the other, starting with the Full Detail Mesh,
+        //and the Indices of a Level are Sorted by Material
+        struct Mesh {
+            std::vector<Vertex> vertices;
+            std::vector<GLuint> indices;
+            std::vector<Lod> lods;
+            std::vector<Meshlet> meshlets;
+            std::vector<Submesh> submeshes;
+
+            //Tangent of each Vertex in XYZ and Bitangent Sign in W, for Normal Mapping. Kept Apart from the Vertices so
+            //they don't Widen the Vertex Buffers, and Empty unless MeshOptions::generateTangents is Set
+            std::vector<glm::vec4> tangents;
+
+            //The Names the OBJ File Gave the Materials with usemtl, in Order of First Use (Empty for Faces before any usemtl)
+            std::vector<std::string> materialNames;
+
+            //Vertices, and Possibly Indices, Left in a Mapped glTF Binary instead of the Vectors
+            std::shared_ptr<const MappedMesh> mapped;
+        };
+
+        //Object Data Pairs the Mesh of an Object with the Materials its Submeshes Use (at Least One), Objects with
+        //Identical Geometry Share the same Mesh
+        using ObjectData = std::pair<std::shared_ptr<const Mesh>, std::vector<Material>>;
+
+        //Mesh Registry will be used to Keep a Single Copy of Identical Meshes, Safe to Use from any Thread
+        class MeshRegistry {
+        public:
+
+            /**
+             * @brief Share - Finds a Registered Mesh with the Same Contents, or Registers this One
+             *
+             * @param Mesh : The Mesh to Share
+             * @return : The Registered Mesh with these Contents
+             */
+            std::shared_ptr<const Mesh> Share(const std::shared_ptr<const Mesh>& mesh) {
+                //Hashes Outside the Lock, so Workers only Serialize on the Lookup
+                uint64_t hash = HashMesh(*mesh);
+
+                std::lock_guard<std::mutex> lock(mutex);
+                auto range = meshes.equal_range(hash);
+                for (auto it = range.first; it != range.second; ++it) {
+                    if (IsSameMesh(*it->second, *mesh))
+                        return it->second;
+                }
+                meshes.emplace(hash, mesh);
+                return mesh;
+            }
+
+            /**
+             * @brief HashMesh - Computes the Content Hash of a Mesh's Vertices and Indices
+             *
+             * @param Mesh : The Mesh to Hash
+             * @return : The Hash
+             */
+            static uint64_t HashMesh(const Mesh& mesh) {
+                uint64_t hash = HashBytes(mesh.vertices.data(), mesh.vertices.size() * sizeof(Vertex));
+                hash = HashBytes(mesh.indices.data(), mesh.indices.size() * sizeof(GLuint), hash);
+                if (mesh.mapped) {
+                    hash = HashBytes(mesh.mapped->vertexData, mesh.mapped->vertexSize, hash);
+                    hash = HashBytes(mesh.mapped->indexData, mesh.mapped->indexCount * sizeof(GLuint), hash);
+                }
+                return hash;
+            }
+
+        private:
+            static bool IsSameMesh(const Mesh& a, const Mesh& b) {
+                return a.vertices.size() == b.vertices.size() && a.indices.size() == b.indices.size() && a.lods.size() == b.lods.size() &&
+                    IsSameBytes(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Vertex)) &&
+                    IsSameBytes(a.indices.data(), b.indices.data(), a.indices.size() * sizeof(GLuint)) &&
+                    IsSameBytes(a.lods.data(), b.lods.data(), a.lods.size() * sizeof(Lod)) &&
+                    a.meshlets.size() == b.meshlets.size() && IsSameBytes(a.meshlets.data(), b.meshlets.data(), a.meshlets.size() * sizeof(Meshlet)) &&
+                    a.submeshes.size() == b.submeshes.size() && IsSameBytes(a.submeshes.data(), b.submeshes.data(), a.submeshes.size() * sizeof(Submesh)) &&
+                    a.materialNames == b.materialNames && IsSameMapping(a.mapped.get(), b.mapped.get());
+            }
+
+            //Empty Vectors may have Null Data, which memcmp must not be Given
+            static bool IsSameBytes(const void* a, const void* b, size_t size) {
+                return size == 0 || std::memcmp(a, b, size) == 0;
+            }
+
+            static bool IsSameMapping(const MappedMesh* a, const MappedMesh* b) {
+                if (!a || !b)
+                    return a == b;
+                return a->vertexCount == b->vertexCount && a->vertexSize == b->vertexSize && a->indexCount == b->indexCount &&
+                    IsSameAttribute(a->layout.position, b->layout.position) && IsSameAttribute(a->layout.normal, b->layout.normal) &&
+                    IsSameAttribute(a->layout.texcoord, b->layout.texcoord) &&
+                    IsSameBytes(a->vertexData, b->vertexData, a->vertexSize) &&
+                    IsSameBytes(a->indexData, b->indexData, a->indexCount * sizeof(GLuint));
+            }
+
+            std::mutex mutex;
+            std::unordered_multimap<uint64_t, std::shared_ptr<const Mesh>> meshes;
+        };
+
+        //Texture Registry will be used to Import each Texture File Once across Objects, Safe to Use from any Thread
+        class TextureRegistry {
+        public:
+
+            /**
+             * @brief Claim - Claims the Import of a Texture File, only the First Claim of each File Succeeds
+             *
+             * @param TextureFile : The Path of the Image File
+             * @return : True if the Caller Imports the File, False if it was Already Claimed
+             */
+            bool Claim(const std::string& textureFile) {
+                std::lock_guard<std::mutex> lock(mutex);
+                return textureFiles.insert(textureFile).second;
+            }
+
+        private:
+            std::mutex mutex;
+            std::unordered_set<std::string> textureFiles;
+        };
+
+        //Vertex Format Selects how Send Stores the Vertices in the VBO
+        enum class VertexFormat {
+            Float,  //The Vertex Struct as it is, 44 Bytes
+            Packed  //The PackedVertex Struct, 16 Bytes
+        };
+
+        //Packed Vertex Struct Stores a Vertex in 16 Bytes: Positions Quantized to 16 Bits against the Mesh Bounds,
+        //Normals as Signed 10:10:10:2 and Texture Coordinates as Half Floats. The Unused Color is Dropped
+        struct PackedVertex {
+            int16_t position[4];
+            uint32_t normal;
+            uint16_t texcoord[2];
+        };
+
+        //Vertex Attribute Struct Describes how one Attribute is Stored in the VBO
+        struct VertexAttribute {
+            GLint size;
+            GLenum type;
+            size_t offset;
+            GLsizei stride = 0; //0 Uses the Stride of the Layout
+        };
+
+        /**
+         * @brief IsSameAttribute - Checks if two Vertex Attributes are Stored the Same Way
+         *
+         * @param A : The First Attribute
+         * @param B : The Second Attribute
+         * @return : True if they Match
+         */
+        static bool IsSameAttribute(const VertexAttribute& a, const VertexAttribute& b) {
+            return a.size == b.size && a.type == b.type && a.offset == b.offset && a.stride == b.stride;
+        }
+
+        //Vertex Layout Struct Describes the Layout of a VBO, so BindVertexArray can Set Up any Vertex Format
+        struct VertexLayout {
+            GLsizei stride = sizeof(Vertex);
+            VertexAttribute position = { 3, GL_FLOAT, offsetof(Vertex, position) };
+            VertexAttribute normal = { 3, GL_FLOAT, offsetof(Vertex, normal) };
+            VertexAttribute texcoord = { 2, GL_FLOAT, offsetof(Vertex, texcoord) };
+
+            //Transform from the Stored Positions to the Mesh Positions, Applied by Draw
+            glm::vec3 positionOffset = glm::vec3(0.0f);
+            float positionScale = 1.0f;
+        };
+
+        //Mesh Buffers Struct will be used to Store the GPU Buffers of a Mesh
+        struct MeshBuffers {
+            GLuint vbo = 0;
+            GLuint ibo = 0;
+            GLsizei indexCount = 0;
+            VertexLayout layout;
+            std::vector<Lod> lods;
+            std::vector<Meshlet> meshlets;
+            std::vector<Submesh> submeshes;
+        };
+
+        //Mapped Mesh Struct Describes a glTF Primitive whose Vertices Already have a Layout the Fixed Function
+        //Arrays can Read, so Send Uploads the Bytes of the Mapped File as they are
+        struct MappedMesh {
+            std::shared_ptr<const GlbFile> file;
+
+            //The Accessors the Vertices are Read from
+            GlbFile::Accessor positions;
+            GlbFile::Accessor normals;
+            GlbFile::Accessor texcoords;
+
+            //The Byte Range Spanning every Attribute, the Layout Offsets are Relative to it
+            const char* vertexData = nullptr;
+            size_t vertexSize = 0;
+            size_t vertexCount = 0;
+            VertexLayout layout;
+
+            //32 Bit Indices, when the File Stores them that Way, Otherwise the Mesh Indices are Used
+            const char* indexData = nullptr;
+            size_t indexCount = 0;
+        };
+
+        //Number of Levels of Detail Built for each Mesh, Including the Full Detail One
+        static constexpr size_t LOD_COUNT = 6;
+
+        //Depth Steps Clusters are Sorted into when they are Ordered to Cut Overdraw
+        static constexpr float OVERDRAW_SORT_STEPS = 8.0f;
+
+        //Largest Projected Error, in Pixels, Tolerated when Picking a Level of Detail
+        static constexpr float LOD_PIXEL_ERROR = 1.0f;
+
+        //A Coarser Level is Only Picked once its Error is this Fraction of the Tolerance, so Objects near a Threshold don't Flicker
+        static constexpr float LOD_HYSTERESIS = 0.5f;
+
+        //Pixel Deleter Frees Pixels Decoded by stb_image
+        struct PixelDeleter {
+            void operator()(unsigned char* pixels) const { stbi_image_free(pixels); }
+        };
+
+        //Cooked Level Struct Locates one Mip Level in the Blocks of a Compressed Image, it is also the Level Record of a Texture Cache
+        struct CookedLevel {
+            uint32_t width;
+            uint32_t height;
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        //Image Struct will be used to Store a Decoded Texture until it is Uploaded on the GL Thread, it Owns its Pixels
+        //so Decoding Tasks can Hand it Over without Leaks, and a Failed Decode Leaves the Pixels Null. The Mip Levels
+        //Below the Decoded One are Built on the Decoding Thread too. A Compressed Image has Blocks instead of Pixels,
+        //the Whole Mip Chain one Level after the Other
+        struct Image {
+            int width = 0;
+            int height = 0;
+            int channels = 0;
+            std::unique_ptr<unsigned char, PixelDeleter> pixels;
+            std::vector<Mipmaps::Level> mips;
+            BlockEncoder::Format compression = BlockEncoder::Format::None;
+            std::vector<CookedLevel> levels;
+            std::vector<unsigned char> blocks;
+        };
+
+        //Largest Anisotropy Textures are Sampled with, Lowered to what the Driver Supports (1 Turns it Off)
+        static constexpr float TEXTURE_ANISOTROPY = 8.0f;
+
+        //Texture Options Struct Chooses how Textures are Stored on the GPU. Compressed Textures are Cooked Once, Block
+        //Compressed on the CPU, and Kept in a Texture Cache Named after the Hash of the Source Image, so Later Runs
+        //Upload the Blocks without Decoding. BC1 Stores Images with Alpha as BC3
+        struct TextureOptions {
+            BlockEncoder::Format compression;
+            BlockEncoder::Quality quality;
+            std::string cacheFolder;
+            float anisotropy;
+
+            //Defaults Set in a Constructor, so the Options can be Default Arguments of the Loader's own Functions
+            TextureOptions() : compression(BlockEncoder::Format::BC1), quality(BlockEncoder::Quality::Normal), anisotropy(TEXTURE_ANISOTROPY) {}
+        };
+
+        //Mesh Options Struct Chooses which Optional Data the Loader Generates for the Meshes it Imports. Tangents are
+        //Off by Default, Nothing Draws with Normal Maps Yet
+        struct MeshOptions {
+            bool generateTangents;
+
+            //Defaults Set in a Constructor, so the Options can be Default Arguments of the Loader's own Functions
+            MeshOptions() : generateTangents(false) {}
+        };
+
+        /**
+         * @brief DecodeTexture - Decodes the Texture Image of a Material, Safe to Call from any Thread
+         *
+         * @param Material : The Material whose Texture will be Decoded
+         * @param TextureOptions : How the Texture is Stored, a Compressed One is Read from its Texture Cache when it has One
+         * @param ThreadCount : The Maximum Number of Threads a Large Image is Decoded with (0 Uses the Hardware Thread Count, or the Workers of the Pool Running the Calling Task)
+         * @return : The Decoded Image, with Null Pixels if the Decoding Failed
+         */
+        static Image DecodeTexture(const Material& material, const TextureOptions& textureOptions = TextureOptions(), size_t threadCount = 0) {
+            MappedFile file(material.textureFile);
+            return file.IsOpen() ? ImportTexture(file.Begin(), file.Size(), material.textureFile, textureOptions, 0, threadCount) : Image();
+        }
+
+        /**
+         * @brief DecodeTexture - Decodes the Texture Image of a Material from a Packed Archive, Safe to Call from any Thread
+         *
+         * The Archive is Meant to be the Only File Opened, so a Compressed Texture is Cooked Every Time unless the
+         * Options Name a Folder for the Texture Caches.
+         *
+         * @param Archive : The Archive, whose Entry Names the Texture File Names of the Material are
+         * @param Material : The Material whose Texture will be Decoded
+         * @param TextureOptions : How the Texture is Stored, a Compressed One is Read from the Texture Cache Folder when it has One
+         * @param ThreadCount : The Maximum Number of Threads a Large Image is Decoded with (0 Uses the Hardware Thread Count, or the Workers of the Pool Running the Calling Task)
+         * @return : The Decoded Image, with Null Pixels if the Decoding Failed
+         */
+        static Image DecodeTexture(const Archive& archive, const Material& material, const TextureOptions& textureOptions = TextureOptions(), size_t threadCount = 0) {
+            Archive::EntryData data = archive.Read(material.textureFile);
+            std::string textureFile = textureOptions.cacheFolder.empty() ? std::string() : material.textureFile;
+            return data ? ImportTexture(data.Begin(), data.Size(), textureFile, textureOptions, 0, threadCount) : Image();
+        }
+
+        /**
+         * @brief DecodeTexture - Decodes a Texture Image File in Memory, Safe to Call from any Thread
+         *
+         * Large Baseline JPEGs with Restart Markers are Split across Threads (JpegDecoder), with the Same Pixels.
+         * The Mip Chain is Built Right After.
+         *
+         * @param Data : The Bytes of the Image File
+         * @param Size : The Number of Bytes
+         * @param RequestedChannels : The Number of Channels of the Pixels, 0 Keeps the Channels of the File
+         * @param ThreadCount : The Maximum Number of Threads a Large Image is Decoded with (0 Uses the Hardware Thread Count, or the Workers of the Pool Running the Calling Task)
+         * @return : The Decoded Image, with Null Pixels if the Decoding Failed
+         */
+        static Image DecodeTexture(const char* data, size_t size, int requestedChannels = 0, size_t threadCount = 0) {
+            Image image;
+            if (size <= INT_MAX)
+                image.pixels.reset(JpegDecoder::Decode(reinterpret_cast<const stbi_uc*>(data), size, &image.width, &image.height, &image.channels, requestedChannels, threadCount));
+            if (image.pixels && requestedChannels != 0)
+                image.channels = requestedChannels;
+            image.mips = Mipmaps::Generate(image.pixels.get(), image.width, image.height, image.channels);
+            return image;
+        }
+
+        /**
+         * @brief ImportTexture - Reads a Texture from its Texture Cache, or Decodes it and Cooks the Cache, Safe to Call from any Thread
+         *
+         * Uncompressed Textures are Just Decoded. A Compressed Texture whose Cache Matches the Hash of the Image File
+         * Skips the Decoding, otherwise the Image is Decoded, its Mip Chain Block Compressed across Threads and the
+         * Cache Written for the Next Run.
+         *
+         * @param Data : The Bytes of the Image File
+         * @param Size : The Number of Bytes
+         * @param TextureFile : The Path the Image File is Known by, which Names its Texture Cache (Empty Cooks the Texture without a Cache)
+         * @param TextureOptions : How the Texture is Stored
+         * @param RequestedChannels : The Number of Channels of the Pixels, 0 Keeps the Channels of the File
+         * @param ThreadCount : The Maximum Number of Threads the Image is Decoded and Compressed with (0 Uses the Hardware Thread Count, or the Workers of the Pool Running the Calling Task)
+         * @return : The Image, Compressed or with Pixels, Empty if the Decoding Failed
+         */
+        static Image ImportTexture(const char* data, size_t size, const std::string& textureFile, const TextureOptions& textureOptions, int requestedChannels = 0,
+            size_t threadCount = 0) {
+            if (textureOptions.compression == BlockEncoder::Format::None)
+                return DecodeTexture(data, size, requestedChannels, threadCount);
+
+            uint64_t sourceHash = HashBytes(data, size);
+            std::string cachePath = textureFile.empty() ? std::string() : TextureCachePath(textureFile, sourceHash, textureOptions);
+            Image image;
+            if (!cachePath.empty() && ReadTextureCache(cachePath, sourceHash, size, textureOptions, image))
+                return image;
+
+            image = DecodeTexture(data, size, requestedChannels, threadCount);
+            if (image.pixels) {
+                CookTexture(image, textureOptions, threadCount);
+                if (!cachePath.empty())
+                    WriteTextureCache(cachePath, sourceHash, size, textureOptions, image);
+            }
+            return image;
+        }
+
+        /**
+         * @brief CookTexture - Block Compresses a Decoded Image and its Mip Chain, Freeing the Pixels
+         *
+         * @param Image : The Decoded Image, Compressed in Place
+         * @param TextureOptions : The Format and Quality
+         * @param ThreadCount : The Maximum Number of Threads each Level is Compressed with (0 Uses the Hardware Thread Count)
+         * @return : Void
+         */
+        static void CookTexture(Image& image, const TextureOptions& textureOptions, size_t threadCount = 0) {
+            bool alpha = image.channels == 2 || image.channels == 4;
+            BlockEncoder::Format format = textureOptions.compression;
+            if (format == BlockEncoder::Format::BC1 && alpha)
+                format = BlockEncoder::Format::BC3;
+
+            //Levels are Laid Out from the Largest, each on a Block Boundary
+            std::vector<const unsigned char*> sources(1, image.pixels.get());
+            image.levels.assign(1, { static_cast<uint32_t>(image.width), static_cast<uint32_t>(image.height), 0, 0 });
+            for (const Mipmaps::Level& mip : image.mips) {
+                sources.push_back(mip.pixels.data());
+                image.levels.push_back({ static_cast<uint32_t>(mip.width), static_cast<uint32_t>(mip.height), 0, 0 });
+            }
+            uint64_t offset = 0;
+            for (CookedLevel& level : image.levels) {
+                level.offset = offset;
+                level.size = BlockEncoder::EncodedSize(static_cast<int>(level.width), static_cast<int>(level.height), format);
+                offset += level.size;
+            }
+
+            image.blocks.resize(static_cast<size_t>(offset));
+            for (size_t l = 0; l < image.levels.size(); ++l) {
+                const CookedLevel& level = image.levels[l];
+                BlockEncoder::EncodeImage(sources[l], static_cast<int>(level.width), static_cast<int>(level.height), image.channels,
+                    format, textureOptions.quality, image.blocks.data() + level.offset, threadCount);
+            }
+            image.compression = format;
+            image.pixels.reset();
+            image.mips.clear();
+        }
+
+        /**
+         * @brief DecodeTextureAsync - Queues the Read of a Texture Image File, which is Decoded once it Arrives
+         *
+         * @param Reader : The Reader
+         * @param TextureFile : The Path of the Image File
+         * @param Image : Receives the Decoded Image, Left with Null Pixels if the Read or the Decoding Failed
+         * @param TextureOptions : How the Texture is Stored, a Compressed One is Read from its Texture Cache when it has One
+         * @return : Void
+         */
+        static void DecodeTextureAsync(AsyncReader& reader, const std::string& textureFile, Image& image, const TextureOptions& textureOptions = TextureOptions()) {
+            //The Callback Runs on a Reader Worker, so a Large Image is Split across the Reader's Idle Workers
+            reader.Read(textureFile, [&image, textureFile, textureOptions](AsyncReader::FileData& data) {
+                if (data)
+                    image = ImportTexture(data.Begin(), data.Size(), textureFile, textureOptions);
+            });
+        }
+
+        /**
+         * @brief DecodeTexturesAsync - Queues the Reads of the Texture Images of a List of Materials
+         *
+         * Each Texture File is Read Once, the Images of Later Materials Naming the Same File, or of a File Another
+         * Object Claimed in the Registry, are Left Empty and LoadTextures Gives them the Texture of the First.
+         *
+         * @param Reader : The Reader
+         * @param Materials : The Materials
+         * @param Images : Receives the Decoded Image of each Material, Must not be Resized until the Reader is Done
+         * @param TextureOptions : How the Textures are Stored
+         * @param TextureRegistry : The Registry Shared by the Objects Loaded Together, or Null
+         * @return : Void
+         */
+        static void DecodeTexturesAsync(AsyncReader& reader, const std::vector<Material>& materials, std::vector<Image>& images, const TextureOptions& textureOptions = TextureOptions(),
+            TextureRegistry* textureRegistry = nullptr) {
+            images.clear();
+            images.resize(materials.size());
+            for (size_t m = 0; m < materials.size(); ++m) {
+                if (ImportsTexture(materials, m, textureRegistry))
+                    DecodeTextureAsync(reader, materials[m].textureFile, images[m], textureOptions);
+            }
+        }
+
+        /**
+         * @brief FindTexture - Finds the First Material with the Same Texture File as a Given One
+         *
+         * @param Materials : The Materials
+         * @param Index : The Index of the Material
+         * @return : The Index of the First Material Naming its Texture File, Possibly Index Itself
+         */
+        static size_t FindTexture(const std::vector<Material>& materials, size_t index) {
+            size_t first = 0;
+            while (materials[first].textureFile != materials[index].textureFile)
+                ++first;
+            return first;
+        }
+
+        /**
+         * @brief ImportsTexture - Whether a Material is the One that Imports its Texture File
+         *
+         * @param Materials : The Materials of the Object
+         * @param Index : The Index of the Material
+         * @param TextureRegistry : The Registry Shared by the Objects Loaded Together, or Null
+         * @return : True if the Material has a Texture no Earlier Material or Other Object Imports
+         */
+        static bool ImportsTexture(const std::vector<Material>& materials, size_t index, TextureRegistry* textureRegistry) {
+            return !materials[index].textureFile.empty() && FindTexture(materials, index) == index &&
+                (!textureRegistry || textureRegistry->Claim(materials[index].textureFile));
+        }
+
+        /**
+         * @brief LoadTextures - Load Textures Uploads the Decoded Textures, Must be Called on the GL Context Thread
+         *
+         * The Images are Decoded Beforehand on Worker Threads (DecodeTexturesAsync), so this Only Hands Finished
+         * Pixels to the Driver. A Texture that Failed to Decode is Reported and its Materials Left Untextured, the
+         * Other Textures are still Uploaded.
+         *
+         * Each Texture Gets Immutable Storage for its Whole Mip Chain where the Driver has glTexStorage2D, and is
+         * Sampled Trilinearly, so Distant Balls Read a Level the Size of their Footprint instead of Level 0.
+         * Compressed Images Hand their Blocks Over as they are, the Driver Keeps them Compressed in Video Memory.
+         * Each Texture File is Uploaded Once, every Material of every Object Naming it Shares the Texture.
+         *
+         * @param ObjectData : The Object Data
+         * @param Images : The Decoded Image of each Material of each Object, Freed after the Upload
+         * @param Anisotropy : The Largest Anisotropy to Sample with, Clamped to the Driver's Limit (1 Turns it Off)
+         * @return : The Number of Textures that Failed to Load
+         */
+        static size_t LoadTextures(std::vector<ObjectData>* objDataList, std::vector<std::vector<Image>>* images, float anisotropy = TEXTURE_ANISOTROPY) {
+            size_t failures = 0;
+
+            //Rows of Tightly Packed RGB Pixels aren't Aligned to 4 Bytes
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+            //Anisotropic Filtering is an Extension, Core only since GL 4.6
+            if (GLEW_EXT_texture_filter_anisotropic) {
+                GLfloat maxAnisotropy = 1.0f;
+                glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+                anisotropy = std::min(anisotropy, maxAnisotropy);
+            }
+            else
+                anisotropy = 1.0f;
+
+            //A Texture File is Decoded for a Single Material, Possibly of Another Object than the Ones Naming it
+            std::unordered_map<std::string, Image*> decodedImages;
+            for (size_t i = 0; i < objDataList->size() && i < images->size(); ++i) {
+                const std::vector<Material>& materials = (*objDataList)[i].second;
+                for (size_t m = 0; m < materials.size() && m < (*images)[i].size(); ++m) {
+                    Image& image = (*images)[i][m];
+                    if (image.pixels || !image.levels.empty())
+                        decodedImages.emplace(materials[m].textureFile, &image);
+                }
+            }
+
+            //The Texture of each File, 0 once it Failed
+            std::unordered_map<std::string, GLuint> textureIDs;
+            for (size_t i = 0; i < objDataList->size(); ++i) {
+                std::vector<Material>& materials = (*objDataList)[i].second;
+                for (size_t m = 0; m < materials.size(); ++m) {
+                    //The Material of the Object Data
+                    Material& material = materials[m];
+
+                    //Materials without a Texture are Drawn Untextured
+                    if (material.textureFile.empty())
+                        continue;
+
+                    //Materials Naming an Uploaded Texture Share it
+                    auto uploaded = textureIDs.find(material.textureFile);
+                    if (uploaded != textureIDs.end()) {
+                        material.textureID = uploaded->second;
+                        continue;
+                    }
+
+                    //The Decoded Texture Image
+                    auto decoded = decodedImages.find(material.textureFile);
+                    Image* image = decoded != decodedImages.end() ? decoded->second : nullptr;
+
+                    //Check's if there were an error in the Loading of the Texture Image
+                    bool compressed = image && !image->levels.empty();
+                    GLenum format = !image ? GL_NONE : compressed ? CompressedTextureFormat(image->compression) : TextureFormat(image->channels);
+                    if (!image || (!image->pixels && !compressed) || format == GL_NONE) {
+                        std::cerr << "Failed to load texture image: " << material.textureFile << std::endl;
+                        material.textureID = 0;
+                        textureIDs.emplace(material.textureFile, 0);
+                        ++failures;
+                        continue;
+                    }
+
+                    //Generate the Texture ID
+                    GLuint textureID;
+                    glGenTextures(1, &textureID);
+
+                    //Activate the desired texture unit
+                    //glActiveTexture(GL_TEXTURE0 + textureID);
+
+                    //Bind The Texture
+                    glBindTexture(GL_TEXTURE_2D, textureID);
+
+                    //Set The Texture Parameters, Trilinear when there are Mip Levels
+                    GLsizei levelCount = static_cast<GLsizei>(compressed ? image->levels.size() : 1 + image->mips.size());
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                    if (anisotropy > 1.0f)
+                        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+
+                    //Loads the Texture Image Data, Level 0 and then the Mip Chain
+                    bool immutable = GLEW_VERSION_4_2 || GLEW_ARB_texture_storage;
+                    if (compressed) {
+                        if (immutable)
+                            glTexStorage2D(GL_TEXTURE_2D, levelCount, format, image->width, image->height);
+                        else
+                            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+                        for (GLint level = 0; level < levelCount; ++level) {
+                            const CookedLevel& cooked = image->levels[level];
+                            GLsizei width = static_cast<GLsizei>(cooked.width);
+                            GLsizei height = static_cast<GLsizei>(cooked.height);
+                            const unsigned char* blocks = image->blocks.data() + cooked.offset;
+                            if (immutable)
+                                glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format, static_cast<GLsizei>(cooked.size), blocks);
+                            else
+                                glCompressedTexImage2D(GL_TEXTURE_2D, level, format, width, height, 0, static_cast<GLsizei>(cooked.size), blocks);
+                        }
+                    }
+                    else if (immutable) {
+                        glTexStorage2D(GL_TEXTURE_2D, levelCount, SizedTextureFormat(image->channels), image->width, image->height);
+                        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, image->width, image->height, format, GL_UNSIGNED_BYTE, image->pixels.get());
+                        for (GLint level = 1; level < levelCount; ++level) {
+                            const Mipmaps::Level& mip = image->mips[level - 1];
+                            glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, mip.width, mip.height, format, GL_UNSIGNED_BYTE, mip.pixels.data());
+                        }
+                    }
+                    else {
+                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
+                        glTexImage2D(GL_TEXTURE_2D, 0, format, image->width, image->height, 0, format, GL_UNSIGNED_BYTE, image->pixels.get());
+                        for (GLint level = 1; level < levelCount; ++level) {
+                            const Mipmaps::Level& mip = image->mips[level - 1];
+                            glTexImage2D(GL_TEXTURE_2D, level, format, mip.width, mip.height, 0, format, GL_UNSIGNED_BYTE, mip.pixels.data());
+                        }
+                    }
+
+                    //Enables the Texture Mapping
+                    glEnable(GL_TEXTURE_2D);
+
+                    //Bind the Texture to the Object
+                    material.textureID = textureID;
+                    textureIDs.emplace(material.textureFile, textureID);
+
+                    //Free the Image Data as soon as the Driver has a Copy
+                    image->pixels.reset();
+                    image->mips.clear();
+                    image->levels.clear();
+                    image->blocks.clear();
+                }
+            }
+
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            images->clear();
+            return failures;
+        }
+
+        /**
+         * @brief TextureFormat - The Pixel Format of a Decoded Image
+         *
+         * @param Channels : The Number of Channels stb_image Decoded
+         * @return : The Format, or GL_NONE for an Unsupported Channel Count
+         */
+        static GLenum TextureFormat(int channels) {
+            switch (channels) {
+            case 1: return GL_LUMINANCE;
+            case 2: return GL_LUMINANCE_ALPHA;
+            case 3: return GL_RGB;
+            case 4: return GL_RGBA;
+            default: return GL_NONE;
+            }
+        }
+
+        /**
+         * @brief CompressedTextureFormat - The Internal Format of a Block Compressed Image
+         *
+         * @param Format : The Block Format
+         * @return : The S3TC or BPTC Format, or GL_NONE for Uncompressed Images
+         */
+        static GLenum CompressedTextureFormat(BlockEncoder::Format format) {
+            switch (format) {
+            case BlockEncoder::Format::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+            case BlockEncoder::Format::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            case BlockEncoder::Format::BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+            default: return GL_NONE;
+            }
+        }
+
+        /**
+         * @brief IsCompressionSupported - Checks if the Driver can Sample a Block Format, Must be Called on the GL Context Thread
+         *
+         * @param Format : The Block Format, BC1 Standing for BC3 too
+         * @return : True if the Driver has the Extension, or Core Version, the Format Needs
+         */
+        static bool IsCompressionSupported(BlockEncoder::Format format) {
+            switch (format) {
+            case BlockEncoder::Format::None: return true;
+            case BlockEncoder::Format::BC7: return GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc;
+            default: return GLEW_EXT_texture_compression_s3tc;
+            }
+        }
+
+        /**
+         * @brief SizedTextureFormat - The Internal Format Immutable Storage Needs for a Decoded Image
+         *
+         * @param Channels : The Number of Channels stb_image Decoded
+         * @return : The 8 Bit per Channel Sized Format, or GL_NONE for an Unsupported Channel Count
+         */
+        static GLenum SizedTextureFormat(int channels) {
+            switch (channels) {
+            case 1: return GL_LUMINANCE8;
+            case 2: return GL_LUMINANCE8_ALPHA8;
+            case 3: return GL_RGB8;
+            case 4: return GL_RGBA8;
+            default: return GL_NONE;
+            }
+        }
+
+        /**
+         * @brief Read - Reads the Files and Creates a List of Object Data
+         *
+         * Every OBJ File (or Mesh Cache) is Queued on an AsyncReader Up Front, and each is Parsed on a Pool of
+         * Worker Threads as soon as its Bytes Arrive, while the Remaining Reads are still in Flight. The MTL and
+         * Texture Reads are Queued as soon as their Names are Parsed, so Startup Takes about as Long as the Longer
+         * of the Disk Reads and the Parsing rather than their Sum. The Results Keep the File Order, and only the
+         * Texture Upload Runs on the Calling (GL Context) Thread. A Ball with a .glb File is Read from it instead
+         * of its OBJ File, and when the Folder was Packed into an Archive (PoolBalls/ into PoolBalls.p3dpak) the
+         * Balls are Read from the Archive.
+         *
+         * @param Folder : The Folder of the Files
+         * @param ThreadCount : The Number of Worker Threads (0 Uses the Hardware Thread Count)
+         * @param CacheFolder : The Folder of the Mesh Caches (Empty Stores them Next to the OBJ Files)
+         * @param TextureOptions : How the Textures are Stored and Sampled, a Compression the Driver Lacks is Turned Off
+         * @param MeshOptions : Which Optional Data is Generated for the Meshes
+         * @return : Object Data List
+         */
+        static std::vector<ObjectData> Read(const std::string& obj_model_folderpath, size_t threadCount = 0, const std::string& cacheFolder = "",
+            const TextureOptions& textureOptions = TextureOptions(), const MeshOptions& meshOptions = MeshOptions()) {
+
+            //The List of Objects that will be Populated with the Objects Vertices and Material
+            std::vector<ObjectData> objDataList(15);
+            std::vector<std::vector<Image>> images(objDataList.size());
+            MeshRegistry meshRegistry;
+            TextureRegistry textureRegistry;
+
+            //Blocks the Driver can't Sample would have to be Decoded Again, so such Textures Stay Uncompressed
+            TextureOptions textures = textureOptions;
+            if (!IsCompressionSupported(textures.compression)) {
+                std::cerr << "Texture compression is not supported by the driver, textures are left uncompressed" << std::endl;
+                textures.compression = BlockEncoder::Format::None;
+            }
+
+            //A Packed Archive of the Folder Replaces its Files, so Startup Opens a Single File
+            Archive archive(ArchivePath(obj_model_folderpath));
+
+            //Each Task Writes Only its own Slot, so the Output Order is Deterministic
+            AsyncReader reader(threadCount);
+            for (size_t i = 0; i < objDataList.size(); ++i) {
+                std::string modelName = "Ball" + std::to_string(i + 1);
+                std::string modelPath = obj_model_folderpath + modelName;
+
+                //An Archived Object Comes First, then a glTF Binary Next to the OBJ File, then the OBJ File
+                std::error_code error;
+                if (archive.IsOpen() && archive.Contains(modelName + ".obj")) {
+                    reader.Run([&, i, modelName]() {
+                        objDataList[i] = ReadArchivedObject(archive, modelName + ".obj", &images[i], threadCount, textures, &textureRegistry, meshOptions);
+                    });
+                }
+                else if (std::filesystem::exists(modelPath + ".glb", error)) {
+                    images[i].resize(1);
+                    reader.Run([&, i, modelPath]() {
+                        objDataList[i] = ReadGlb(modelPath + ".glb", &images[i][0], textures, &textureRegistry, meshOptions);
+                    });
+                }
+                else {
+                    LoadObjectAsync(reader, modelPath + ".obj", obj_model_folderpath, cacheFolder, objDataList[i], images[i], threadCount, textures, &textureRegistry, meshOptions);
+                }
+            }
+            reader.Wait();
+
+            //Identical Geometry is Kept Once, the Duplicates are Freed Here
+            for (ObjectData& objectData : objDataList)
+                objectData.first = meshRegistry.Share(objectData.first);
+
+            //Load the Textures for the Objects Data
+            LoadTextures(&objDataList, &images, textures.anisotropy);
+
+            return objDataList;
+        }
+
+        /**
+         * @brief LoadObject - Loads one Object from its Mesh Cache, or Parses it and Refreshes the Cache
+         *
+         * @param ObjPath : The Path of the OBJ File
+         * @param Folder : The Folder of the Files
+         * @param CacheFolder : The Folder of the Mesh Caches (Empty Stores them Next to the OBJ Files)
+         * @param ThreadCount : The Number of Threads a Large OBJ File is Parsed with (0 Uses the Hardware Thread Count)
+         * @param MeshOptions : Which Optional Data is Generated for the Mesh
+         * @return : The Object Mesh and Materials
+         */
+        static ObjectData LoadObject(const std::string& obj_model_filepath, const std::string& obj_model_folderpath, const std::string& cacheFolder, size_t threadCount = 0,
+            const MeshOptions& meshOptions = MeshOptions()) {
+            std::string cachePath = MeshCachePath(obj_model_filepath, cacheFolder);
+
+            ObjectData objectData;
+            if (ReadMeshCache(cachePath, obj_model_filepath, obj_model_folderpath, objectData, meshOptions))
+                return objectData;
+
+            std::string mtlFileName;
+            objectData = ReadObject(obj_model_filepath, obj_model_folderpath, &mtlFileName, threadCount, meshOptions);
+            WriteMeshCache(cachePath, obj_model_filepath, obj_model_folderpath, mtlFileName, objectData);
+            return objectData;
+        }
+
+        /**
+         * @brief LoadObjectAsync - Queues the Loading of one Object from its Mesh Cache, or from its Files as the Reader Delivers them
+         *
+         * The OBJ Text is Parsed as soon as it Arrives, and the MTL Read is Queued before the Levels of Detail are Built,
+         * so the Read Overlaps that Work. The Texture Read is Queued once the MTL Text is Parsed. Whichever of the Mesh and
+         * the Material is Finished Last Completes the Object and Refreshes its Mesh Cache.
+         *
+         * @param Reader : The Reader, which Must Outlive the Queued Work
+         * @param ObjPath : The Path of the OBJ File
+         * @param Folder : The Folder of the Files
+         * @param CacheFolder : The Folder of the Mesh Caches (Empty Stores them Next to the OBJ Files)
+         * @param ObjectData : Receives the Object Mesh and Materials once the Reader is Done
+         * @param Images : Receives the Decoded Texture of each Material once the Reader is Done
+         * @param ThreadCount : The Number of Threads a Large OBJ File is Parsed with (0 Uses the Hardware Thread Count)
+         * @param TextureOptions : How the Textures are Stored
+         * @param TextureRegistry : The Registry Shared by the Objects Loaded Together, or Null, Must Outlive the Queued Work
+         * @param MeshOptions : Which Optional Data is Generated for the Mesh
+         * @return : Void
+         */
+        static void LoadObjectAsync(AsyncReader& reader, const std::string& obj_model_filepath, const std::string& obj_model_folderpath, const std::string& cacheFolder, ObjectData& objectData, std::vector<Image>& images, size_t threadCount = 0,
+            const TextureOptions& textureOptions = TextureOptions(), TextureRegistry* textureRegistry = nullptr, const MeshOptions& meshOptions = MeshOptions()) {
+            reader.Run([=, &reader, &objectData, &images]() {
+                std::string cachePath = MeshCachePath(obj_model_filepath, cacheFolder);
+                if (ReadMeshCache(cachePath, obj_model_filepath, obj_model_folderpath, objectData, meshOptions)) {
+                    DecodeTexturesAsync(reader, objectData.second, images, textureOptions, textureRegistry);
+                    return;
+                }
+
+                reader.Read(obj_model_filepath, [=, &reader, &objectData, &images](AsyncReader::FileData& objText) {
+                    if (!objText) {
+                        throw std::runtime_error("Failed to open OBJ file: " + obj_model_filepath);
+                    }
+
+                    std::shared_ptr<PendingObject> pending = std::make_shared<PendingObject>();
+                    pending->mesh = ReadObjectText(objText.Begin(), objText.End(), pending->mtlFileName, threadCount);
+
+                    auto complete = [=, &objectData]() {
+                        objectData = std::make_pair(std::make_shared<const Mesh>(std::move(pending->mesh)), std::move(pending->materials));
+                        WriteMeshCache(cachePath, obj_model_filepath, obj_model_folderpath, pending->mtlFileName, objectData);
+                    };
+
+                    //Load Materials from MTL File, the Names are Copied since the Mesh is Processed Meanwhile
+                    std::string mtlPath = MaterialFolder(obj_model_folderpath) + pending->mtlFileName;
+                    std::vector<std::string> materialNames = pending->mesh.materialNames;
+                    reader.Read(mtlPath, [=, &reader, &images](AsyncReader::FileData& mtlText) {
+                        std::vector<Material> library;
+                        if (mtlText)
+                            ParseMaterials(mtlText.Begin(), mtlText.End(), MaterialFolder(obj_model_folderpath), library);
+                        else
+                            std::cerr << "Failed to open MTL file: " << mtlPath << std::endl;
+
+                        pending->materials = ResolveMaterials(library, materialNames);
+                        DecodeTexturesAsync(reader, pending->materials, images, textureOptions, textureRegistry);
+                        if (pending->remaining.fetch_sub(1) == 1)
+                            complete();
+                    });
+
+                    //Runs the Import Stages that Work on the Indexed Mesh
+                    ProcessMesh(pending->mesh, threadCount, meshOptions);
+                    if (pending->remaining.fetch_sub(1) == 1)
+                        complete();
+                });
+            });
+        }
+
+        //Pending Object Struct Holds an Object whose Mesh and Materials are Finished on Different Tasks
+        struct PendingObject {
+            Mesh mesh;
+            std::vector<Material> materials;
+            std::string mtlFileName;
+
+            //The Mesh and the Material, the Task that Finishes the Last of them Completes the Object
+            std::atomic<int> remaining{ 2 };
+        };
+
+        /**
+         * @brief ReadObject - Reads one OBJ File and the MTL File it References
+         *
+         * @param ObjPath : The Path of the OBJ File
+         * @param Folder : The Folder of the Files
+         * @param MtlFileName : Receives the Name of the Referenced MTL File, if not Null
+         * @param ThreadCount : The Number of Threads a Large File is Parsed with (0 Uses the Hardware Thread Count)
+         * @param MeshOptions : Which Optional Data is Generated for the Mesh
+         * @return : The Object Mesh and Materials
+         */
+        static ObjectData ReadObject(const std::string& obj_model_filepath, const std::string& obj_model_folderpath, std::string* mtlFileNameOut = nullptr, size_t threadCount = 0,
+            const MeshOptions& meshOptions = MeshOptions()) {
+
+            //Maps the Whole File so the Lines can be Tokenized in Place
+            MappedFile objFile(obj_model_filepath);
+
+            if (!objFile.IsOpen()) {
+                throw std::runtime_error("Failed to open OBJ file: " + obj_model_filepath);
+            }
+
+            std::vector<Material> library;
+            std::string mtlFileName;
+            Mesh mesh = ReadObjectText(objFile.Begin(), objFile.End(), mtlFileName, threadCount);
+
+            //Load Materials from MTL File
+            std::string mtlPath = MaterialFolder(obj_model_folderpath) + mtlFileName;
+            ReadMaterials(mtlPath, obj_model_folderpath, library);
+            std::vector<Material> materials = ResolveMaterials(library, mesh.materialNames);
+
+            if (mtlFileNameOut)
+                *mtlFileNameOut = mtlFileName;
+
+            //Runs the Import Stages that Work on the Indexed Mesh
+            ProcessMesh(mesh, threadCount, meshOptions);
+
+            //Creates a Pair of Mesh and Materials
+            return std::make_pair(std::make_shared<const Mesh>(std::move(mesh)), std::move(materials));
+        }
+
+        //Element Counts Struct Holds how many Positions, Texture Coordinates and Normals a Part of an OBJ File has
+        struct ElementCounts {
+            int positions;
+            int texcoords;
+            int normals;
+        };
+
+        /**
+         * @brief ReadObjectText - Builds the Indexed Mesh of OBJ Text
+         *
+         * @param Begin : The Start of the Text
+         * @param End : The End of the Text
+         * @param MtlFileName : Receives the Name of the Referenced MTL File
+         * @param ThreadCount : The Number of Threads Large Text is Parsed with (0 Uses the Hardware Thread Count)
+         * @return : The Indexed Mesh, before the Import Stages Run on it
+         */
+        static Mesh ReadObjectText(const char* begin, const char* end, std::string& mtlFileName, size_t threadCount = 0) {
+
+            //Large Files are Split into Chunks that are Parsed Concurrently
+            if (threadCount == 0)
+                threadCount = DefaultThreadCount();
+            size_t chunkCount = std::min(threadCount, static_cast<size_t>(end - begin) / PARSE_CHUNK_MIN_SIZE);
+            if (chunkCount > 1)
+                return ParseObjectChunks(begin, end, chunkCount, threadCount, mtlFileName);
+
+            //Sizes Everything Up Front from the Statistics the Exporter Wrote, when the File has them
+            ModelStatistics statistics = ReadModelStatistics(begin, end);
+
+            //Parse Temporaries Live in one Arena that is Released in a Single Step when the Object is Done
+            std::pmr::monotonic_buffer_resource arena(ArenaSize(statistics));
+
+            //Builds the Indexed Mesh as the Elements are Streamed from the File
+            MeshBuilder builder(statistics, &arena);
+            ParseObject(begin, end, builder);
+
+            mtlFileName = builder.MaterialLibraryName();
+            return builder.TakeMesh();
+        }
+
+        /**
+         * @brief ReadArchivedObject - Reads one Object, its Materials and Textures from a Packed Archive
+         *
+         * The OBJ and MTL Text is Parsed in Place, and the Textures Decoded, Straight from the Mapped Archive.
+         * Archived Objects don't Use Mesh Caches, the Archive is Meant to be the Only File Opened, and their Textures
+         * are Only Cached when the Texture Options Name a Cache Folder.
+         *
+         * @param Archive : The Archive
+         * @param ObjName : The Name of the OBJ Entry
+         * @param Images : Receives the Decoded Texture of each Material, if not Null
+         * @param ThreadCount : The Number of Threads a Large File or Image is Parsed with (0 Uses the Hardware Thread Count)
+         * @param TextureOptions : How the Textures are Stored
+         * @param TextureRegistry : The Registry Shared by the Objects Loaded Together, or Null
+         * @param MeshOptions : Which Optional Data is Generated for the Mesh
+         * @return : The Object Mesh and Materials
+         */
+        static ObjectData ReadArchivedObject(const Archive& archive, const std::string& objName, std::vector<Image>* images = nullptr, size_t threadCount = 0,
+            const TextureOptions& textureOptions = TextureOptions(), TextureRegistry* textureRegistry = nullptr, const MeshOptions& meshOptions = MeshOptions()) {
+            Archive::EntryData objText = archive.Read(objName);
+            if (!objText)
+                throw std::runtime_error("Failed to open OBJ file: " + archive.Path() + ":" + objName);
+
+            std::vector<Material> library;
+            std::string mtlFileName;
+            Mesh mesh = ReadObjectText(objText.Begin(), objText.End(), mtlFileName, threadCount);
+
+            //Names in the MTL File are Relative to the Archive Root, as they were to the Folder
+            Archive::EntryData mtlText = archive.Read(mtlFileName);
+            if (mtlText)
+                ParseMaterials(mtlText.Begin(), mtlText.End(), "", library);
+            else
+                std::cerr << "Failed to open MTL file: " << archive.Path() << ":" << mtlFileName << std::endl;
+            std::vector<Material> materials = ResolveMaterials(library, mesh.materialNames);
+
+            if (images) {
+                images->clear();
+                images->resize(materials.size());
+                for (size_t m = 0; m < materials.size(); ++m) {
+                    if (ImportsTexture(materials, m, textureRegistry))
+                        (*images)[m] = DecodeTexture(archive, materials[m], textureOptions, threadCount);
+                }
+            }
+
+            ProcessMesh(mesh, threadCount, meshOptions);
+            return std::make_pair(std::make_shared<const Mesh>(std::move(mesh)), std::move(materials));
+        }
+
+        /**
+         * @brief ArchivePath - The Path of the Packed Archive of a Folder
+         *
+         * @param Folder : The Folder of the Files
+         * @return : The Path of the .p3dpak File Next to the Folder
+         */
+        static std::string ArchivePath(const std::string& obj_model_folderpath) {
+            std::string folder = obj_model_folderpath;
+            while (!folder.empty() && (folder.back() == '/' || folder.back() == '\\'))
+                folder.pop_back();
+            return folder + ".p3dpak";
+        }
+
+        /**
+         * @brief ParseObjectChunks - Parses an OBJ File Split at Line Boundaries into Chunks that are Parsed Concurrently
+         *
+         * A First Pass Counts the Positions, Texture Coordinates and Normals of every Chunk, so each Chunk Knows the
+         * Index Bases it Starts at and Writes its Elements Straight into the Shared Arrays. Chunks then Deduplicate
+         * their Face Corners Locally, and the Merge Step Maps the Local Vertices to Global Ones in File Order, so
+         * the Mesh is Identical to the one a Sequential Parse Builds.
+         *
+         * @param Begin : The Start of the File
+         * @param End : The End of the File
+         * @param ChunkCount : The Number of Chunks
+         * @param ThreadCount : The Number of Threads
+         * @param MtlFileName : Receives the Name of the Referenced MTL File
+         * @return : The Indexed Mesh
+         */
+        static Mesh ParseObjectChunks(const char* begin, const char* end, size_t chunkCount, size_t threadCount, std::string& mtlFileName) {
+
+            //Chunks Start after a Line Break, so no Line is Split
+            std::vector<const char*> chunkStarts(chunkCount + 1, end);
+            chunkStarts[0] = begin;
+            for (size_t c = 1; c < chunkCount; ++c) {
+                const char* target = begin + static_cast<size_t>(end - begin) / chunkCount * c;
+                const char* lineEnd = FindLineEnd(std::max(target, chunkStarts[c - 1]), end);
+                chunkStarts[c] = lineEnd < end ? lineEnd + 1 : end;
+            }
+
+            //Counts the Elements of each Chunk, and from them the Index Base of each Chunk
+            std::vector<ElementCounts> bases(chunkCount + 1, ElementCounts{ 0, 0, 0 });
+            ParallelFor(chunkCount, threadCount, [&](size_t c) {
+                bases[c + 1] = CountElements(chunkStarts[c], chunkStarts[c + 1]);
+            });
+            for (size_t c = 1; c <= chunkCount; ++c) {
+                bases[c].positions += bases[c - 1].positions;
+                bases[c].texcoords += bases[c - 1].texcoords;
+                bases[c].normals += bases[c - 1].normals;
+            }
+
+            std::vector<glm::vec3> positions(static_cast<size_t>(bases[chunkCount].positions));
+            std::vector<glm::vec2> texcoords(static_cast<size_t>(bases[chunkCount].texcoords));
+            std::vector<glm::vec3> normals(static_cast<size_t>(bases[chunkCount].normals));
+
+            //Parses the Chunks, each Resolving Relative Indices from its own Bases
+            std::vector<std::unique_ptr<ChunkBuilder>> chunks(chunkCount);
+            ParallelFor(chunkCount, threadCount, [&](size_t c) {
+                chunks[c] = std::make_unique<ChunkBuilder>(positions.data(), texcoords.data(), normals.data(), bases[c], bases[c + 1]);
+                ParseObject(chunkStarts[c], chunkStarts[c + 1], *chunks[c], bases[c]);
+            });
+
+            //Merges the Local Vertices in File Order, the First Chunk to Use a Triplet Creates its Vertex
+            size_t localVertexCount = 0;
+            for (const auto& chunk : chunks)
+                localVertexCount += chunk->corners.size();
+
+            IndexMap indexMap(localVertexCount);
+            std::vector<FaceCorner> vertexCorners;
+            vertexCorners.reserve(localVertexCount);
+            std::vector<std::vector<GLuint>> remaps(chunkCount);
+            for (size_t c = 0; c < chunkCount; ++c) {
+                const ChunkBuilder& chunk = *chunks[c];
+                remaps[c].resize(chunk.corners.size());
+                for (size_t local = 0; local < chunk.corners.size(); ++local) {
+                    const FaceCorner& corner = chunk.corners[local];
+                    GLuint nextIndex = static_cast<GLuint>(vertexCorners.size());
+                    GLuint index = indexMap.FindOrInsert(corner.position, corner.texcoord, corner.normal, nextIndex);
+                    if (index == nextIndex)
+                        vertexCorners.push_back(corner);
+                    remaps[c][local] = index;
+                }
+
+                //The Last Material Library Wins, as in a Sequential Parse
+                if (chunk.hasMaterialLibrary)
+                    mtlFileName = chunk.mtlFileName;
+            }
+
+            //Numbers the Materials in Order of First Use, Triangles before the First usemtl of a Chunk Use
+            //the Material the Previous Chunks Selected Last
+            Mesh mesh;
+            std::vector<std::vector<size_t>> groupMaterials(chunkCount);
+            std::string selectedName;
+            for (size_t c = 0; c < chunkCount; ++c) {
+                const MaterialGroups& materials = chunks[c]->materials;
+                for (size_t g = 0; g < materials.names.size(); ++g) {
+                    const std::string& name = g == materials.inheritedGroup ? selectedName : materials.names[g];
+                    size_t material = static_cast<size_t>(std::find(mesh.materialNames.begin(), mesh.materialNames.end(), name) - mesh.materialNames.begin());
+                    if (material == mesh.materialNames.size())
+                        mesh.materialNames.push_back(name);
+                    groupMaterials[c].push_back(material);
+                }
+                if (materials.selectsMaterial)
+                    selectedName = materials.selectedName;
+            }
+
+            //Each Material's Triangles are Contiguous, in File Order, so every Chunk Group Knows where it Goes
+            std::vector<size_t> materialOffsets(mesh.materialNames.size() + 1, 0);
+            for (size_t c = 0; c < chunkCount; ++c) {
+                for (size_t g = 0; g < groupMaterials[c].size(); ++g)
+                    materialOffsets[groupMaterials[c][g] + 1] += chunks[c]->materials.groups[g].size();
+            }
+            for (size_t material = 0; material < mesh.materialNames.size(); ++material) {
+                mesh.submeshes.push_back({ static_cast<GLuint>(material), static_cast<GLuint>(materialOffsets[material]), static_cast<GLuint>(materialOffsets[material + 1]) });
+                materialOffsets[material + 1] += materialOffsets[material];
+            }
+            std::vector<std::vector<size_t>> groupOffsets(chunkCount);
+            for (size_t c = 0; c < chunkCount; ++c) {
+                for (size_t g = 0; g < groupMaterials[c].size(); ++g) {
+                    groupOffsets[c].push_back(materialOffsets[groupMaterials[c][g]]);
+                    materialOffsets[groupMaterials[c][g]] += chunks[c]->materials.groups[g].size();
+                }
+            }
+
+            //Translates the Local Indices and Creates the Vertices, both in Parallel
+            mesh.indices.resize(materialOffsets.back());
+            mesh.vertices.resize(vertexCorners.size());
+            ParallelFor(chunkCount, threadCount, [&](size_t c) {
+                const std::vector<std::vector<GLuint>>& groups = chunks[c]->materials.groups;
+                for (size_t g = 0; g < groups.size(); ++g) {
+                    for (size_t i = 0; i < groups[g].size(); ++i)
+                        mesh.indices[groupOffsets[c][g] + i] = remaps[c][groups[g][i]];
+                }
+
+                size_t vertexBegin = vertexCorners.size() * c / chunkCount;
+                size_t vertexEnd = vertexCorners.size() * (c + 1) / chunkCount;
+                for (size_t v = vertexBegin; v < vertexEnd; ++v) {
+                    const FaceCorner& corner = vertexCorners[v];
+                    Vertex vertex{};
+                    if (corner.position != FaceCorner::NONE)
+                        vertex.position = positions[static_cast<size_t>(corner.position)];
+                    if (corner.texcoord != FaceCorner::NONE)
+                        vertex.texcoord = texcoords[static_cast<size_t>(corner.texcoord)];
+                    if (corner.normal != FaceCorner::NONE)
+                        vertex.normal = normals[static_cast<size_t>(corner.normal)];
+                    mesh.vertices[v] = vertex;
+                }
+            });
+
+            return mesh;
+        }
+
+        /**
+         * @brief CountElements - Counts the Position, Texture Coordinate and Normal Lines of OBJ Text
+         *
+         * @param Begin : The Start of the Text
+         * @param End : The End of the Text
+         * @return : The Counts
+         */
+        static ElementCounts CountElements(const char* begin, const char* end) {
+            ElementCounts counts = { 0, 0, 0 };
+            for (const char* line = begin; line < end; ) {
+                const char* lineEnd = FindLineEnd(line, end);
+                const char* cursor = line;
+                std::string_view prefix = NextToken(cursor, lineEnd);
+
+                if (prefix == "v")
+                    ++counts.positions;
+                else if (prefix == "vt")
+                    ++counts.texcoords;
+                else if (prefix == "vn")
+                    ++counts.normals;
+
+                line = lineEnd < end ? lineEnd + 1 : end;
+            }
+            return counts;
+        }
+
+        /**
+         * @brief StreamObject - Parses an OBJ File and Hands every Element to a Visitor as soon as it is Read
+         *
+         * Nothing is Accumulated by the Parser: the File is Mapped and each Line is Decoded in Place, so
+         * a Visitor that Writes Straight to its Destination (a Mapped GPU Buffer, a Cache File, ...) Imports
+         * Files of any Size within the Memory it Chooses to Keep. The Visitor should Derive from ObjVisitor
+         * and Hide the Callbacks it Needs, Calls are Resolved at Compile Time.
+         *
+         * @param ObjPath : The Path of the OBJ File
+         * @param Visitor : Receives the Statistics, then every Element in File Order
+         * @return : Void
+         */
+        template <typename Visitor>
+        static void StreamObject(const std::string& obj_model_filepath, Visitor& visitor) {
+            MappedFile objFile(obj_model_filepath);
+
+            if (!objFile.IsOpen()) {
+                throw std::runtime_error("Failed to open OBJ file: " + obj_model_filepath);
+            }
+
+            visitor.Statistics(ReadModelStatistics(objFile.Begin(), objFile.End()));
+            ParseObject(objFile.Begin(), objFile.End(), visitor);
+        }
+
+        /**
+         * @brief ParseObject - Parses OBJ Text in Memory and Hands every Element to a Visitor
+         *
+         * Relative (Negative) Face Indices are Resolved against the Elements Streamed so Far, and Polygons
+         * are Split into Triangle Fans, so the Visitor Only Sees Triangles with Zero Based Indices.
+         *
+         * @param Begin : The Start of the Text
+         * @param End : The End of the Text
+         * @param Visitor : Receives every Element in Text Order
+         * @return : Void
+         */
+        template <typename Visitor>
+        static void ParseObject(const char* begin, const char* end, Visitor& visitor) {
+            ParseObject(begin, end, visitor, ElementCounts{ 0, 0, 0 });
+        }
+
+        /**
+         * @brief ParseObject - Parses a Part of an OBJ File, Given how many Elements the Preceding Text Holds
+         *
+         * @param Begin : The Start of the Text, at a Line Boundary
+         * @param End : The End of the Text, at a Line Boundary
+         * @param Visitor : Receives every Element in Text Order
+         * @param Bases : The Number of each Kind of Element before the Text, which Relative Indices Count from
+         * @return : Void
+         */
+        template <typename Visitor>
+        static void ParseObject(const char* begin, const char* end, Visitor& visitor, const ElementCounts& bases) {
+            int positionCount = bases.positions, texcoordCount = bases.texcoords, normalCount = bases.normals;
+            FaceCorner corners[3];
+
+            //Line Breaks and Token Boundaries Come from a Vectorized Pre-Pass over the Text
+            TextScanner scanner(begin, end);
+
+            do {
+                std::string_view prefix = scanner.NextToken();
+
+                if (prefix == "v") {
+                    //Vertex Position
+                    glm::vec3 position;
+                    ParseFloat(scanner.NextToken(), position.x);
+                    ParseFloat(scanner.NextToken(), position.y);
+                    ParseFloat(scanner.NextToken(), position.z);
+                    visitor.Position(position);
+                    ++positionCount;
+                }
+                else if (prefix == "vt") {
+                    //Vertex Texture Coordinates
+                    glm::vec2 texcoord;
+                    ParseFloat(scanner.NextToken(), texcoord.x);
+                    ParseFloat(scanner.NextToken(), texcoord.y);
+                    visitor.Texcoord(texcoord);
+                    ++texcoordCount;
+                }
+                else if (prefix == "vn") {
+                    //Vetex Normal
+                    glm::vec3 normal;
+                    ParseFloat(scanner.NextToken(), normal.x);
+                    ParseFloat(scanner.NextToken(), normal.y);
+                    ParseFloat(scanner.NextToken(), normal.z);
+                    visitor.Normal(normal);
+                    ++normalCount;
+                }
+                else if (prefix == "mtllib") {
+                    //Material File Name
+                    visitor.MaterialLibrary(scanner.NextToken());
+                }
+                else if (prefix == "usemtl") {
+                    //Material of the Following Faces, Object and Group Names (o, g) don't Split the Mesh
+                    visitor.UseMaterial(scanner.NextToken());
+                }
+                else if (prefix == "f") {
+                    //Faces, the First Corner is Shared by every Triangle of the Fan
+                    size_t cornerCount = 0;
+                    for (std::string_view faceToken = scanner.NextToken(); !faceToken.empty(); faceToken = scanner.NextToken()) {
+                        int vertexIndex = 0, texcoordIndex = 0, normalIndex = 0;
+                        const char* face = faceToken.data();
+                        const char* faceEnd = face + faceToken.size();
+                        face = ParseIndex(face, faceEnd, vertexIndex);
+                        face = ParseIndex(face, faceEnd, texcoordIndex);
+                        face = ParseIndex(face, faceEnd, normalIndex);
+
+                        FaceCorner corner = { ResolveIndex(vertexIndex, positionCount), ResolveIndex(texcoordIndex, texcoordCount), ResolveIndex(normalIndex, normalCount) };
+                        if (cornerCount < 3) {
+                            corners[cornerCount++] = corner;
+                        }
+                        else {
+                            corners[1] = corners[2];
+                            corners[2] = corner;
+                        }
+                        if (cornerCount == 3)
+                            visitor.Triangle(corners);
+                    }
+                }
+            } while (scanner.NextLine());
+        }
+
+        /**
+         * @brief ResolveIndex - Converts a One Based or Relative OBJ Index to a Zero Based One
+         *
+         * @param Index : The Index as Written in the File, 0 if it was Omitted
+         * @param Count : The Number of Elements of that Kind Read so Far
+         * @return : The Zero Based Index, or FaceCorner::NONE if it was Omitted
+         */
+        static int ResolveIndex(int index, int count) {
+            if (index > 0)
+                return index - 1;
+            if (index < 0)
+                return count + index;
+            return FaceCorner::NONE;
+        }
+
+        //Files Smaller than this are Parsed on a Single Thread, Splitting them Costs more than it Saves
+        static constexpr size_t PARSE_CHUNK_MIN_SIZE = 4 << 20;
+
+        //Element Counts Announced by the "#Model Statistics" Comment Block at the Top of an OBJ File
+        struct ModelStatistics {
+            size_t positionCount = 0;
+            size_t texcoordCount = 0;
+            size_t normalCount = 0;
+            size_t faceCount = 0;
+
+            //Unique Vertices Expected after Deduplication
+            size_t vertexCount = 0;
+        };
+
+        //Face Corner Struct Holds the Zero Based Position, Texture Coordinate and Normal Indices of a Face Corner
+        struct FaceCorner {
+            static constexpr int NONE = -1;
+
+            int position;
+            int texcoord;
+            int normal;
+        };
+
+        //Obj Visitor is the Base of StreamObject Visitors, Derived Visitors Hide the Callbacks they Need
+        struct ObjVisitor {
+            void Statistics(const ModelStatistics&) {}
+            void Position(const glm::vec3&) {}
+            void Texcoord(const glm::vec2&) {}
+            void Normal(const glm::vec3&) {}
+            void Triangle(const FaceCorner*) {}
+            void MaterialLibrary(std::string_view) {}
+            void UseMaterial(std::string_view) {}
+        };
+
+        /**
+         * @brief ReadModelStatistics - Reads the Element Counts from the Leading Comments of an OBJ File
+         *
+         * The Counts are Only Hints for Preallocation, so they are Clamped to what the File Size Allows
+         * and Missing or Malformed Entries are Left at Zero.
+         *
+         * @param Begin : The Start of the File
+         * @param End : The End of the File
+         * @return : The Counts Found
+         */
+        static ModelStatistics ReadModelStatistics(const char* begin, const char* end) {
+            ModelStatistics statistics;
+
+            //The Shortest Possible Element Line, "f 1 1 1" Followed by a Line Break
+            size_t maxCount = static_cast<size_t>(end - begin) / 8;
+
+            for (const char* line = begin; line < end; ) {
+                const char* lineEnd = FindLineEnd(line, end);
+                const char* cursor = line;
+                std::string_view token = NextToken(cursor, lineEnd);
+
+                //The Block Ends at the First Line that isn't a Comment
+                if (!token.empty() && token[0] != '#')
+                    break;
+
+                //Lines Look Like "#Number of vertices............. 4034"
+                std::string_view comment(line, static_cast<size_t>(lineEnd - line));
+                while (!comment.empty() && IsBlank(comment.back()))
+                    comment.remove_suffix(1);
+
+                size_t labelEnd = comment.find('.');
+                if (labelEnd != std::string_view::npos) {
+                    std::string_view label = comment.substr(0, labelEnd);
+                    size_t countStart = comment.find_last_of(" .") + 1;
+                    size_t count = 0;
+                    std::from_chars(comment.data() + countStart, comment.data() + comment.size(), count);
+                    count = std::min(count, maxCount);
+
+                    if (label.find("vertices") != std::string_view::npos)
+                        statistics.positionCount = count;
+                    else if (label.find("UV coordinates") != std::string_view::npos)
+                        statistics.texcoordCount = count;
+                    else if (label.find("normals") != std::string_view::npos)
+                        statistics.normalCount = count;
+                    else if (label.find("faces") != std::string_view::npos)
+                        statistics.faceCount = count;
+                }
+
+                line = lineEnd < end ? lineEnd + 1 : end;
+            }
+
+            //Every Unique Vertex Uses a Distinct Position, UV and Normal Combination, Usually as Many as the Largest Array
+            statistics.vertexCount = std::max({ statistics.positionCount, statistics.texcoordCount, statistics.normalCount });
+            if (statistics.faceCount > 0)
+                statistics.vertexCount = std::min(statistics.vertexCount, statistics.faceCount * 3);
+
+            return statistics;
+        }
+
+        /**
+         * @brief ArenaSize - The Initial Size of the Parse Arena, Enough for all Temporaries when the Statistics are Exact
+         *
+         * @param Statistics : The Counts Read from the File
+         * @return : The Size in Bytes
+         */
+        static size_t ArenaSize(const ModelStatistics& statistics) {
+            size_t size = statistics.positionCount * sizeof(glm::vec3)
+                + statistics.texcoordCount * sizeof(glm::vec2)
+                + statistics.normalCount * sizeof(glm::vec3)
+                + IndexMap::TableSize(statistics.vertexCount)
+                + 256;
+            return size;
+        }
+
+        /**
+         * @brief ProcessMesh - Runs the Import Stages that Prepare a Parsed Mesh for Rendering
+         *
+         * @param Mesh : The Mesh, Modified in Place
+         * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count, or the Workers of the Pool Running the Calling Task)
+         * @param MeshOptions : Which Optional Data is Generated for the Mesh
+         * @return : Void
+         */
+        static void ProcessMesh(Mesh& mesh, size_t threadCount = 0, const MeshOptions& meshOptions = MeshOptions()) {
+            BuildTangentSpace(mesh, threadCount, meshOptions);
+            BuildLods(mesh);
+            BuildMeshlets(mesh);
+            OptimizeMesh(mesh);
+        }
+
+        /**
+         * @brief BuildTangentSpace - Fills in Missing Normals and Generates the Tangents of a Mesh
+         *
+         * Vertices without a Normal, Left Zero by the Parser, Take the Smooth Normal of their Position.
+         * The Tangents Go to Mesh::tangents, and only when MeshOptions::generateTangents is Set. A Vertex
+         * Shared by Mirrored and Unmirrored Triangles is Split, its Copy is Appended to the Vertices.
+         *
+         * @param Mesh : The Mesh, whose Indices Hold the Full Detail Triangles
+         * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count)
+         * @param MeshOptions : Which Optional Data is Generated for the Mesh
+         * @return : Void
+         */
+        static void BuildTangentSpace(Mesh& mesh, size_t threadCount = 0, const MeshOptions& meshOptions = MeshOptions()) {
+            std::vector<glm::vec3> positions(mesh.vertices.size()), normals(mesh.vertices.size());
+            std::vector<glm::vec2> texcoords(mesh.vertices.size());
+            bool normalsMissing = false;
+            for (size_t v = 0; v < mesh.vertices.size(); ++v) {
+                positions[v] = mesh.vertices[v].position;
+                normals[v] = mesh.vertices[v].normal;
+                texcoords[v] = mesh.vertices[v].texcoord;
+                normalsMissing = normalsMissing || normals[v] == glm::vec3(0.0f);
+            }
+
+            if (normalsMissing) {
+                std::vector<glm::vec3> smoothNormals;
+                TangentSpace::GenerateNormals(positions, MeshletBuilder::WeldPositions(positions), mesh.indices, smoothNormals, threadCount);
+                for (size_t v = 0; v < normals.size(); ++v) {
+                    if (normals[v] == glm::vec3(0.0f))
+                        normals[v] = mesh.vertices[v].normal = smoothNormals[v];
+                }
+            }
+
+            mesh.tangents.clear();
+            if (!meshOptions.generateTangents)
+                return;
+
+            //The Split Vertices are Copies of the Vertices whose Indices the Generator Returns, in Order
+            std::vector<uint32_t> splitVertices;
+            TangentSpace::GenerateTangents(positions, normals, texcoords, mesh.indices, mesh.tangents, splitVertices, threadCount);
+            mesh.vertices.reserve(mesh.vertices.size() + splitVertices.size());
+            for (uint32_t vertex : splitVertices)
+                mesh.vertices.push_back(mesh.vertices[vertex]);
+        }
+
+        /**
+         * @brief BuildLods - Appends a Chain of Simplified Levels of Detail to the Mesh Indices
+         *
+         * Each Level Halves the Triangles of the Previous One with Quadric Error Simplification, and the
+         * Chain Stops Early once the Mesh can't be Reduced Further. Each Material is Simplified on its own,
+         * so the Indices of every Level Stay Sorted by Material and Material Borders Stay in Place.
+         *
+         * @param Mesh : The Mesh, whose Indices Hold the Full Detail Triangles
+         * @return : Void
+         */
+        static void BuildLods(Mesh& mesh) {
+            //A Mesh Read without Materials is a Single Submesh of the First One
+            if (mesh.submeshes.empty() && !mesh.indices.empty())
+                mesh.submeshes.push_back({ 0, 0, static_cast<GLuint>(mesh.indices.size()) });
+            Lod fullDetail = { 0, static_cast<GLuint>(mesh.indices.size()), 0.0f };
+            fullDetail.submeshCount = static_cast<GLuint>(mesh.submeshes.size());
+            mesh.lods.assign(1, fullDetail);
+
+            std::vector<glm::vec3> positions(mesh.vertices.size());
+            for (size_t v = 0; v < mesh.vertices.size(); ++v)
+                positions[v] = mesh.vertices[v].position;
+
+            float error = 0.0f;
+            std::vector<GLuint> current;
+            std::vector<std::vector<GLuint>> simplified;
+            for (size_t level = 1; level < LOD_COUNT; ++level) {
+                const Lod previous = mesh.lods.back();
+                float levelError = 0.0f;
+                size_t simplifiedCount = 0;
+                simplified.assign(previous.submeshCount, std::vector<GLuint>());
+                for (size_t s = 0; s < previous.submeshCount; ++s) {
+                    const Submesh& submesh = mesh.submeshes[previous.submeshOffset + s];
+                    current.assign(mesh.indices.begin() + submesh.indexOffset, mesh.indices.begin() + submesh.indexOffset + submesh.indexCount);
+
+                    //A Material that can't be Simplified Keeps its Triangles
+                    float submeshError = 0.0f;
+                    simplified[s] = Simplifier::Simplify(positions, current, current.size() / 6 * 3, FLT_MAX, &submeshError);
+                    if (simplified[s].empty())
+                        simplified[s] = current;
+                    levelError = std::max(levelError, submeshError);
+                    simplifiedCount += simplified[s].size();
+                }
+                if (simplifiedCount == 0 || simplifiedCount * 10 > size_t(previous.indexCount) * 9)
+                    break;
+
+                //Errors Accumulate, since each Level is Simplified from the Previous One
+                error += levelError;
+                Lod lod = { static_cast<GLuint>(mesh.indices.size()), static_cast<GLuint>(simplifiedCount), error };
+                lod.submeshOffset = static_cast<GLuint>(mesh.submeshes.size());
+                lod.submeshCount = previous.submeshCount;
+                for (size_t s = 0; s < previous.submeshCount; ++s) {
+                    GLuint material = mesh.submeshes[previous.submeshOffset + s].material;
+                    mesh.submeshes.push_back({ material, static_cast<GLuint>(mesh.indices.size()), static_cast<GLuint>(simplified[s].size()) });
+                    mesh.indices.insert(mesh.indices.end(), simplified[s].begin(), simplified[s].end());
+                }
+                mesh.lods.push_back(lod);
+            }
+        }
+
+        /**
+         * @brief BuildMeshlets - Splits every Level of Detail into Clusters that Draw Culls One by One
+         *
+         * The Indices of each Submesh are Reordered so its Clusters are Contiguous, the Triangles Stay the Same.
+         * Clusters never Span Materials, so the Clusters of a Level are those of its Submeshes, one after the other.
+         *
+         * @param Mesh : The Mesh, whose Levels of Detail are Built
+         * @return : Void
+         */
+        static void BuildMeshlets(Mesh& mesh) {
+            std::vector<glm::vec3> positions(mesh.vertices.size());
+            for (size_t v = 0; v < mesh.vertices.size(); ++v)
+                positions[v] = mesh.vertices[v].position;
+            std::vector<uint32_t> positionIds = MeshletBuilder::WeldPositions(positions);
+
+            mesh.meshlets.clear();
+            for (Lod& lod : mesh.lods) {
+                lod.meshletOffset = static_cast<GLuint>(mesh.meshlets.size());
+                for (size_t s = lod.submeshOffset; s < size_t(lod.submeshOffset) + lod.submeshCount; ++s) {
+                    Submesh& submesh = mesh.submeshes[s];
+                    std::vector<Meshlet> meshlets = MeshletBuilder::Build(positions, positionIds, mesh.indices, submesh.indexOffset, submesh.indexCount);
+                    submesh.meshletOffset = static_cast<GLuint>(mesh.meshlets.size());
+                    submesh.meshletCount = static_cast<GLuint>(meshlets.size());
+                    mesh.meshlets.insert(mesh.meshlets.end(), meshlets.begin(), meshlets.end());
+                }
+                lod.meshletCount = static_cast<GLuint>(mesh.meshlets.size()) - lod.meshletOffset;
+            }
+        }
+
+        /**
+         * @brief OptimizeMesh - Reorders the Triangles and Vertices of a Mesh for the GPU
+         *
+         * The Clusters of each Submesh are Sorted so those Facing Away from the Centre of the Level, which Tend to
+         * Hide the Others, are Drawn First to Cut Overdraw. Triangles are then Reordered inside each Cluster for the
+         * Post-Transform Vertex Cache, and Vertices are Renumbered in the Order they are First Drawn so the Vertex
+         * Fetch Walks Memory Forward. The Triangles of every Submesh Stay the Same.
+         *
+         * @param Mesh : The Mesh, whose Meshlets are Built
+         * @return : Void
+         */
+        static void OptimizeMesh(Mesh& mesh) {
+            std::vector<GLuint> sorted;
+            for (Lod& lod : mesh.lods) {
+                if (lod.meshletCount == 0) {
+                    for (size_t s = lod.submeshOffset; s < size_t(lod.submeshOffset) + lod.submeshCount; ++s)
+                        VertexCacheOptimizer::OptimizeTriangles(mesh.indices.data() + mesh.submeshes[s].indexOffset, mesh.submeshes[s].indexCount);
+                    continue;
+                }
+
+                //Centre and Extent of the Level, Weighted by how many Triangles each Cluster Holds
+                const Meshlet* lodBegin = mesh.meshlets.data() + lod.meshletOffset;
+                const Meshlet* lodEnd = lodBegin + lod.meshletCount;
+                glm::vec3 centre(0.0f);
+                for (const Meshlet* meshlet = lodBegin; meshlet != lodEnd; ++meshlet)
+                    centre += meshlet->center * static_cast<float>(meshlet->indexCount);
+                centre /= static_cast<float>(std::max<GLuint>(lod.indexCount, 1));
+                float extent = 0.0f;
+                for (const Meshlet* meshlet = lodBegin; meshlet != lodEnd; ++meshlet)
+                    extent = std::max(extent, glm::length(meshlet->center - centre) + meshlet->radius);
+
+                //Keys are Coarse Steps of the Extent, so Clusters of a Convex Surface Keep their Order and the
+                //Visible Runs Draw Merges Stay Long
+                float step = extent > 0.0f ? extent / OVERDRAW_SORT_STEPS : 1.0f;
+                auto key = [&](const Meshlet& meshlet) {
+                    if (meshlet.coneCutoff <= 0.0f)
+                        return 0.0f;
+                    return std::floor(glm::dot(meshlet.center - centre, meshlet.coneAxis) / step);
+                };
+
+                //Clusters Move Only Within their Submesh, so the Materials Stay Contiguous
+                for (size_t s = lod.submeshOffset; s < size_t(lod.submeshOffset) + lod.submeshCount; ++s) {
+                    const Submesh& submesh = mesh.submeshes[s];
+                    Meshlet* begin = mesh.meshlets.data() + submesh.meshletOffset;
+                    Meshlet* end = begin + submesh.meshletCount;
+                    std::stable_sort(begin, end, [&](const Meshlet& a, const Meshlet& b) {
+                        return key(a) > key(b);
+                    });
+
+                    sorted.clear();
+                    for (Meshlet* meshlet = begin; meshlet != end; ++meshlet) {
+                        GLuint offset = submesh.indexOffset + static_cast<GLuint>(sorted.size());
+                        sorted.insert(sorted.end(), mesh.indices.begin() + meshlet->indexOffset, mesh.indices.begin() + meshlet->indexOffset + meshlet->indexCount);
+                        meshlet->indexOffset = offset;
+                    }
+                    std::copy(sorted.begin(), sorted.end(), mesh.indices.begin() + submesh.indexOffset);
+                }
+
+                for (Meshlet* meshlet = mesh.meshlets.data() + lod.meshletOffset; meshlet != mesh.meshlets.data() + lod.meshletOffset + lod.meshletCount; ++meshlet)
+                    VertexCacheOptimizer::OptimizeTriangles(mesh.indices.data() + meshlet->indexOffset, meshlet->indexCount);
+            }
+
+            //The Full Detail Level Comes First, so its Vertices are the Ones Laid Out in Draw Order
+            std::vector<uint32_t> remap = VertexCacheOptimizer::FetchRemap(mesh.indices, mesh.vertices.size());
+            std::vector<Vertex> vertices(mesh.vertices.size());
+            for (size_t v = 0; v < vertices.size(); ++v)
+                vertices[remap[v]] = mesh.vertices[v];
+            mesh.vertices = std::move(vertices);
+            if (!mesh.tangents.empty()) {
+                std::vector<glm::vec4> tangents(mesh.tangents.size());
+                for (size_t v = 0; v < tangents.size(); ++v)
+                    tangents[remap[v]] = mesh.tangents[v];
+                mesh.tangents = std::move(tangents);
+            }
+            for (GLuint& index : mesh.indices)
+                index = remap[index];
+        }
+
+        /**
+         * @brief ReportMeshStatistics - Prints how Well an OBJ File Uses the Post-Transform Cache, before and after Import
+         *
+         * @param ObjPath : The Path of the OBJ File
+         * @return : False if the File couldn't be Read
+         */
+        static bool ReportMeshStatistics(const std::string& obj_model_filepath) {
+            MappedFile objFile(obj_model_filepath);
+            if (!objFile.IsOpen()) {
+                std::cerr << "Failed to open OBJ file: " << obj_model_filepath << std::endl;
+                return false;
+            }
+
+            std::string mtlFileName;
+            Mesh mesh = ReadObjectText(objFile.Begin(), objFile.End(), mtlFileName);
+            auto print = [](const char* stage, const std::vector<GLuint>& indices, const Lod& lod) {
+                VertexCacheOptimizer::Statistics statistics = VertexCacheOptimizer::Analyze(indices.data() + lod.indexOffset, lod.indexCount);
+                std::cout << stage << ": " << lod.indexCount / 3 << " triangles, ACMR " << statistics.acmr << ", ATVR " << statistics.atvr << std::endl;
+            };
+
+            std::cout << obj_model_filepath << " (FIFO cache of " << VertexCacheOptimizer::CACHE_SIZE << " vertices)" << std::endl;
+            print("  Parsed", mesh.indices, { 0, static_cast<GLuint>(mesh.indices.size()), 0.0f });
+            ProcessMesh(mesh);
+            for (size_t level = 0; level < mesh.lods.size(); ++level)
+                print(("  Lod " + std::to_string(level)).c_str(), mesh.indices, mesh.lods[level]);
+            return true;
+        }
+
+        /**
+         * @brief ReportDecodeTimes - Prints how Long the JPEG Images of a Folder Take to Decode on One Thread
+         *
+         * Each Image is Decoded Straight from its Mapping by stb_image, so the Times are the Decoder's alone, with
+         * the IDCT, Upsampling and Color Conversion Kernels it Picked for this CPU.
+         *
+         * @param Folder : The Folder of the Images
+         * @param Repetitions : The Number of Times each Image is Decoded
+         * @return : False if no Image of the Folder could be Decoded
+         */
+        static bool ReportDecodeTimes(const std::string& folder, int repetitions) {
+            std::error_code error;
+            std::vector<std::filesystem::path> imagePaths;
+            for (std::filesystem::directory_iterator it(folder, error), end; !error && it != end; it.increment(error)) {
+                std::filesystem::path extension = it->path().extension();
+                if (extension == ".jpg" || extension == ".jpeg")
+                    imagePaths.push_back(it->path());
+            }
+            std::sort(imagePaths.begin(), imagePaths.end());
+            repetitions = std::max(repetitions, 1);
+
+            std::cout << folder << " (" << repetitions << " decodes of each image on one thread)" << std::endl;
+            double totalSeconds = 0.0, totalPixels = 0.0;
+            for (const std::filesystem::path& imagePath : imagePaths) {
+                MappedFile file(imagePath.string());
+                if (!file.IsOpen() || file.Size() > INT_MAX) {
+                    std::cerr << "Failed to open image: " << imagePath.string() << std::endl;
+                    continue;
+                }
+
+                int width = 0, height = 0, channels = 0;
+                double bestSeconds = DBL_MAX, seconds = 0.0;
+                bool decoded = true;
+                for (int r = 0; r < repetitions && decoded; ++r) {
+                    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                    stbi_uc* pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(file.Begin()), static_cast<int>(file.Size()), &width, &height, &channels, 0);
+                    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    decoded = pixels != nullptr;
+                    stbi_image_free(pixels);
+                    bestSeconds = std::min(bestSeconds, elapsed);
+                    seconds += elapsed;
+                }
+                if (!decoded) {
+                    std::cerr << "Failed to decode image: " << imagePath.string() << std::endl;
+                    continue;
+                }
+
+                double pixelCount = static_cast<double>(width) * height;
+                std::cout << "  " << imagePath.filename().string() << ": " << width << "x" << height << ", best " << bestSeconds * 1000.0 << " ms, mean "
+                    << seconds / repetitions * 1000.0 << " ms, " << pixelCount / bestSeconds / 1e6 << " Mpixels/s" << std::endl;
+                totalSeconds += seconds;
+                totalPixels += pixelCount * repetitions;
+            }
+
+            if (totalPixels == 0.0)
+                return false;
+            std::cout << "  All: " << totalPixels / totalSeconds / 1e6 << " Mpixels/s" << std::endl;
+            return true;
+        }
+
+        /**
+         * @brief CullMeshlets - Lists the Index Ranges of the Clusters of a Submesh that may be Seen
+         *
+         * Clusters are Contiguous in the Index Buffer, so Runs of Visible Clusters are Merged into one Range.
+         *
+         * @param Meshlets : The Meshlets of the Mesh
+         * @param Submesh : The Submesh, with at Least one Meshlet
+         * @param Culler : The View the Clusters are Tested Against
+         * @param Counts : Receives the Index Count of each Range
+         * @param Offsets : Receives the Byte Offset of each Range in the Index Buffer
+         * @return : The Number of Indices Left to Draw
+         */
+        static size_t CullMeshlets(const std::vector<Meshlet>& meshlets, const Submesh& submesh, const MeshletCuller& culler, std::vector<GLsizei>& counts, std::vector<const GLvoid*>& offsets) {
+            counts.clear();
+            offsets.clear();
+            size_t indexCount = 0;
+            size_t rangeEnd = SIZE_MAX;
+            for (size_t m = submesh.meshletOffset; m < size_t(submesh.meshletOffset) + submesh.meshletCount; ++m) {
+                const Meshlet& meshlet = meshlets[m];
+                if (!culler.IsVisible(meshlet))
+                    continue;
+                if (meshlet.indexOffset == rangeEnd) {
+                    counts.back() += static_cast<GLsizei>(meshlet.indexCount);
+                }
+                else {
+                    counts.push_back(static_cast<GLsizei>(meshlet.indexCount));
+                    offsets.push_back(reinterpret_cast<const GLvoid*>(meshlet.indexOffset * sizeof(GLuint)));
+                }
+                rangeEnd = size_t(meshlet.indexOffset) + meshlet.indexCount;
+                indexCount += meshlet.indexCount;
+            }
+            return indexCount;
+        }
+
+        /**
+         * @brief SelectLod - Picks the Level of Detail of an Object from its Projected Size, with Hysteresis
+         *
+         * @param Lods : The Levels of Detail, from Finest to Coarsest
+         * @param PixelsPerUnit : How Many Pixels one Mesh Unit Covers on Screen
+         * @param Current : The Level Used Last Frame
+         * @return : The Level to Use
+         */
+        static size_t SelectLod(const std::vector<Lod>& lods, float pixelsPerUnit, size_t current) {
+            if (lods.empty())
+                return 0;
+            current = std::min(current, lods.size() - 1);
+
+            //Refines as soon as the Current Level Exceeds the Tolerance
+            while (current > 0 && lods[current].error * pixelsPerUnit > LOD_PIXEL_ERROR)
+                --current;
+
+            //Coarsens Only when the Next Level is Well Within it
+            while (current + 1 < lods.size() && lods[current + 1].error * pixelsPerUnit <= LOD_PIXEL_ERROR * LOD_HYSTERESIS)
+                ++current;
+
+            return current;
+        }
+
+        /**
+         * @brief PixelsPerUnit - How Many Pixels one Unit at the Origin of the Current Modelview Matrix Covers
+         *
+         * @return : The Projected Size of one Unit, for both Orthographic and Perspective Projections
+         */
+        static float PixelsPerUnit() {
+            glm::mat4 modelView, projection;
+            GLint viewport[4];
+            glGetFloatv(GL_MODELVIEW_MATRIX, glm::value_ptr(modelView));
+            glGetFloatv(GL_PROJECTION_MATRIX, glm::value_ptr(projection));
+            glGetIntegerv(GL_VIEWPORT, viewport);
+
+            //Perspective Projections Divide by the Distance to the Camera
+            float depth = 1.0f;
+            if (projection[2][3] != 0.0f)
+                depth = std::max(-modelView[3].z, 1e-4f);
+
+            float scale = glm::length(glm::vec3(modelView[0]));
+            return scale * std::abs(projection[0][0]) * viewport[2] * 0.5f / depth;
+        }
+
+        /**
+         * @brief ReadMaterials - Reads every Material of a MTL File
+         *
+         * @param MtlPath : The Path of the MTL File
+         * @param Folder : The Folder of the Files
+         * @param Materials : Receives the Materials, in File Order
+         * @return : Void
+         */
+        static void ReadMaterials(const std::string& mtlPath, const std::string& obj_model_folderpath, std::vector<Material>& materials) {
+            MappedFile mtlFile(mtlPath);
+            if (!mtlFile.IsOpen()) {
+                std::cerr << "Failed to open MTL file: " << mtlPath << std::endl;
+                return;
+            }
+
+            ParseMaterials(mtlFile.Begin(), mtlFile.End(), MaterialFolder(obj_model_folderpath), materials);
+        }
+
+        /**
+         * @brief ParseMaterials - Reads every Material from MTL Text, each newmtl Starts a New One
+         *
+         * @param Begin : The Start of the Text
+         * @param End : The End of the Text
+         * @param TextureFolder : The Prefix of Texture File Names
+         * @param Materials : Receives the Materials, in Text Order
+         * @return : Void
+         */
+        static void ParseMaterials(const char* begin, const char* end, const std::string& textureFolder, std::vector<Material>& materials) {
+            TextScanner scanner(begin, end);
+            do {
+                std::string_view mtlPrefix = scanner.NextToken();
+
+                if (mtlPrefix == "newmtl") {
+                    //Material Name
+                    materials.push_back(Material{});
+                    materials.back().name = scanner.NextToken();
+                    continue;
+                }
+
+                //Properties before the First newmtl Belong to no Material
+                if (materials.empty())
+                    continue;
+                Material& material = materials.back();
+
+                if (mtlPrefix == "Ka") {
+                    //Ambient Reflection Coefficient
+                    ParseFloat(scanner.NextToken(), material.ambient.r);
+                    ParseFloat(scanner.NextToken(), material.ambient.g);
+                    ParseFloat(scanner.NextToken(), material.ambient.b);
+                }
+                else if (mtlPrefix == "Kd") {
+                    //Difuse Reflection coefficient
+                    ParseFloat(scanner.NextToken(), material.diffuse.r);
+                    ParseFloat(scanner.NextToken(), material.diffuse.g);
+                    ParseFloat(scanner.NextToken(), material.diffuse.b);
+                }
+                else if (mtlPrefix == "Ks") {
+                    //Specular Reflection coefficient
+                    ParseFloat(scanner.NextToken(), material.specular.r);
+                    ParseFloat(scanner.NextToken(), material.specular.g);
+                    ParseFloat(scanner.NextToken(), material.specular.b);
+                }
+                else if (mtlPrefix == "Ns") {
+                    //Specular exponent
+                    ParseFloat(scanner.NextToken(), material.shininess);
+                }
+                else if (mtlPrefix == "map_Kd") {
+                    //Material Texture
+                    material.textureFile = textureFolder + std::string(scanner.NextToken());
+                }
+            } while (scanner.NextLine());
+        }
+
+        /**
+         * @brief ResolveMaterials - Looks Up the Materials a Mesh Uses, by Name, in the Materials of its MTL File
+         *
+         * Faces before any usemtl, and Files without one, Use the First Material of the File. A Name the
+         * File doesn't Define is Reported and Gets a Default Material.
+         *
+         * @param Library : The Materials of the MTL File
+         * @param MaterialNames : The Names the Mesh Uses, in Order of First Use
+         * @return : The Material of each Name, at Least One
+         */
+        static std::vector<Material> ResolveMaterials(const std::vector<Material>& library, const std::vector<std::string>& materialNames) {
+            std::vector<Material> materials;
+            for (const std::string& name : materialNames) {
+                auto found = name.empty() ? library.begin() : std::find_if(library.begin(), library.end(), [&name](const Material& material) {
+                    return material.name == name;
+                });
+                if (found != library.end()) {
+                    materials.push_back(*found);
+                }
+                else {
+                    if (!name.empty())
+                        std::cerr << "Material not found in MTL file: " << name << std::endl;
+                    materials.push_back(Material{});
+                    materials.back().name = name;
+                }
+            }
+            if (materials.empty())
+                materials.push_back(library.empty() ? Material{} : library.front());
+            return materials;
+        }
+
+        /**
+         * @brief MaterialFolder - The Folder that MTL and Texture File Names are Relative to
+         *
+         * @param Folder : The Folder of the Files
+         * @return : The Folder, Ending in '/'
+         */
+        static std::string MaterialFolder(const std::string& obj_model_folderpath) {
+            return obj_model_folderpath.substr(0, obj_model_folderpath.find_last_of('/')) + "/";
+        }
+
+        //Ambient Reflection of glTF Materials, which have None, as a Fraction of the Base Color (the MTL Files Use 0.1)
+        static constexpr float GLTF_AMBIENT = 0.1f;
+
+        /**
+         * @brief ReadGlb - Reads the First Mesh Primitive of a glTF Binary and its Material
+         *
+         * When the Primitive Stores Float Positions, Float or Normalized Normals and Float Texture Coordinates,
+         * the Mesh Keeps the File Mapped and Send Uploads those Bytes Directly, without Touching each Vertex.
+         * Other Layouts are Converted to Vertices and Get Levels of Detail like an OBJ File. Node Transforms
+         * are not Applied, the Mesh is Loaded in its own Space.
+         *
+         * @param GlbPath : The Path of the .glb File
+         * @param Image : Receives the Decoded Base Color Texture, if not Null
+         * @param TextureOptions : How the Texture is Stored
+         * @param TextureRegistry : The Registry Shared by the Objects Loaded Together, or Null
+         * @param MeshOptions : Which Optional Data is Generated for a Converted Mesh, a Mapped Mesh Gets None
+         * @return : The Object Mesh and Material
+         */
+        static ObjectData ReadGlb(const std::string& glbPath, Image* image = nullptr, const TextureOptions& textureOptions = TextureOptions(),
+            TextureRegistry* textureRegistry = nullptr, const MeshOptions& meshOptions = MeshOptions()) {
+            std::shared_ptr<const GlbFile> file = std::make_shared<const GlbFile>(glbPath);
+
+            const JsonValue* primitives = file->Element("meshes", 0).Find("primitives");
+            if (!primitives || !primitives->IsArray() || primitives->Size() == 0)
+                throw std::runtime_error("glTF mesh has no primitives: " + glbPath);
+            if (primitives->Size() > 1)
+                std::cerr << "Only the first primitive of the glTF mesh is loaded: " << glbPath << std::endl;
+
+            const JsonValue& primitive = primitives->At(0);
+            if (primitive.NumberOr("mode", 4) != 4)
+                throw std::runtime_error("glTF primitive is not a triangle list: " + glbPath);
+
+            const JsonValue* attributes = primitive.Find("attributes");
+            if (!attributes || !attributes->Find("POSITION"))
+                throw std::runtime_error("glTF primitive has no positions: " + glbPath);
+
+            //Normals and Texture Coordinates are Optional, Missing Ones are Left Empty
+            GlbFile::Accessor positions = file->GetAccessor(file->ReadIndexMember(*attributes, "POSITION", SIZE_MAX));
+            GlbFile::Accessor normals, texcoords;
+            if (attributes->Find("NORMAL"))
+                normals = file->GetAccessor(file->ReadIndexMember(*attributes, "NORMAL", SIZE_MAX));
+            if (attributes->Find("TEXCOORD_0"))
+                texcoords = file->GetAccessor(file->ReadIndexMember(*attributes, "TEXCOORD_0", SIZE_MAX));
+            if (positions.componentType != GlbFile::FLOAT || positions.components != 3 ||
+                (normals.data && (normals.components != 3 || normals.count != positions.count)) ||
+                (texcoords.data && (texcoords.components != 2 || texcoords.count != positions.count)))
+                throw std::runtime_error("Unsupported glTF vertex attributes: " + glbPath);
+
+            Mesh mesh;
+            std::shared_ptr<MappedMesh> mapped = MapVertices(file, positions, normals, texcoords);
+
+            //Unindexed Primitives Draw the Vertices in Order
+            if (primitive.Find("indices")) {
+                GlbFile::Accessor indices = file->GetAccessor(file->ReadIndexMember(primitive, "indices", SIZE_MAX));
+                if (indices.components != 1 || (indices.componentType != GlbFile::UNSIGNED_BYTE &&
+                    indices.componentType != GlbFile::UNSIGNED_SHORT && indices.componentType != GlbFile::UNSIGNED_INT))
+                    throw std::runtime_error("Unsupported glTF index type: " + glbPath);
+
+                //Indices Reach the GPU Unchecked, so they are Validated Here
+                for (size_t i = 0; i < indices.count; ++i) {
+                    if (indices.ReadIndex(i) >= positions.count)
+                        throw std::runtime_error("glTF index out of range: " + glbPath);
+                }
+
+                if (mapped && indices.componentType == GlbFile::UNSIGNED_INT) {
+                    mapped->indexData = indices.data;
+                    mapped->indexCount = indices.count;
+                }
+                else {
+                    mesh.indices.resize(indices.count);
+                    for (size_t i = 0; i < indices.count; ++i)
+                        mesh.indices[i] = indices.ReadIndex(i);
+                }
+            }
+            else {
+                mesh.indices.resize(positions.count);
+                for (size_t i = 0; i < positions.count; ++i)
+                    mesh.indices[i] = static_cast<GLuint>(i);
+            }
+
+            if (mapped) {
+                mesh.mapped = std::move(mapped);
+            }
+            else {
+                mesh.vertices = ReadGlbVertices(positions, normals, texcoords);
+                ProcessMesh(mesh, 0, meshOptions);
+            }
+
+            std::vector<Material> materials(1, ReadGlbMaterial(*file, primitive, image, textureOptions, textureRegistry));
+            return std::make_pair(std::make_shared<const Mesh>(std::move(mesh)), std::move(materials));
+        }
+
+        /**
+         * @brief MapVertices - Describes glTF Vertex Attributes as a Layout of the Mapped File, if the Fixed Function Arrays can Read them
+         *
+         * @param File : The glTF Binary
+         * @param Positions : The Position Accessor
+         * @param Normals : The Normal Accessor
+         * @param Texcoords : The Texture Coordinate Accessor
+         * @return : The Mapped Mesh, or Null if the Vertices Need Converting
+         */
+        static std::shared_ptr<MappedMesh> MapVertices(const std::shared_ptr<const GlbFile>& file, const GlbFile::Accessor& positions, const GlbFile::Accessor& normals, const GlbFile::Accessor& texcoords) {
+            //glNormalPointer Normalizes Signed Integers, glTexCoordPointer Can't Normalize at all
+            bool normalsMatch = normals.data && (normals.componentType == GlbFile::FLOAT ||
+                ((normals.componentType == GlbFile::BYTE || normals.componentType == GlbFile::SHORT) && normals.normalized));
+            bool texcoordsMatch = texcoords.data && texcoords.componentType == GlbFile::FLOAT;
+            if (!normalsMatch || !texcoordsMatch || positions.count == 0 ||
+                positions.stride > INT_MAX || normals.stride > INT_MAX || texcoords.stride > INT_MAX)
+                return nullptr;
+
+            std::shared_ptr<MappedMesh> mapped = std::make_shared<MappedMesh>();
+            mapped->file = file;
+            mapped->positions = positions;
+            mapped->normals = normals;
+            mapped->texcoords = texcoords;
+
+            const char* first = std::min({ positions.data, normals.data, texcoords.data });
+            const char* last = std::max({ positions.data + positions.ByteLength(), normals.data + normals.ByteLength(), texcoords.data + texcoords.ByteLength() });
+            mapped->vertexData = first;
+            mapped->vertexSize = static_cast<size_t>(last - first);
+            mapped->vertexCount = positions.count;
+
+            VertexLayout& layout = mapped->layout;
+            layout.stride = static_cast<GLsizei>(positions.stride);
+            layout.position = { 3, GL_FLOAT, static_cast<size_t>(positions.data - first), static_cast<GLsizei>(positions.stride) };
+            layout.normal = { 3, static_cast<GLenum>(normals.componentType), static_cast<size_t>(normals.data - first), static_cast<GLsizei>(normals.stride) };
+            layout.texcoord = { 2, GL_FLOAT, static_cast<size_t>(texcoords.data - first), static_cast<GLsizei>(texcoords.stride) };
+            return mapped;
+        }
+
+        /**
+         * @brief ReadGlbVertices - Converts glTF Vertex Attributes to Vertices
+         *
+         * @param Positions : The Position Accessor
+         * @param Normals : The Normal Accessor, Zero Normals if it has no Data
+         * @param Texcoords : The Texture Coordinate Accessor, Zero Coordinates if it has no Data
+         * @return : The Vertices
+         */
+        static std::vector<Vertex> ReadGlbVertices(const GlbFile::Accessor& positions, const GlbFile::Accessor& normals, const GlbFile::Accessor& texcoords) {
+            std::vector<Vertex> vertices(positions.count, Vertex{});
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                Vertex& vertex = vertices[i];
+                vertex.position = glm::vec3(positions.ReadFloat(i, 0), positions.ReadFloat(i, 1), positions.ReadFloat(i, 2));
+                if (normals.data)
+                    vertex.normal = glm::vec3(normals.ReadFloat(i, 0), normals.ReadFloat(i, 1), normals.ReadFloat(i, 2));
+                if (texcoords.data)
+                    vertex.texcoord = glm::vec2(texcoords.ReadFloat(i, 0), texcoords.ReadFloat(i, 1));
+            }
+            return vertices;
+        }
+
+        /**
+         * @brief ReadMappedVertices - Reads the Vertices of a Mapped Mesh, for Code that Needs them on the CPU
+         *
+         * @param Mapped : The Mapped Mesh
+         * @return : The Vertices
+         */
+        static std::vector<Vertex> ReadMappedVertices(const MappedMesh& mapped) {
+            return ReadGlbVertices(mapped.positions, mapped.normals, mapped.texcoords);
+        }
+
+        /**
+         * @brief ReadGlbMaterial - Fills a Material from the Metallic-Roughness Block of a glTF Material
+         *
+         * Metals Lose their Diffuse Color and Tint the Specular, Dielectrics Reflect 4%, and the Roughness
+         * is Turned into the Blinn-Phong Exponent with the same Highlight Width.
+         *
+         * @param File : The glTF Binary
+         * @param Primitive : The Primitive whose Material is Read
+         * @param Image : Receives the Decoded Base Color Texture, if not Null and no Other Object Claimed it
+         * @param TextureOptions : How the Texture is Stored
+         * @param TextureRegistry : The Registry Shared by the Objects Loaded Together, or Null
+         * @return : The Material
+         */
+        static Material ReadGlbMaterial(const GlbFile& file, const JsonValue& primitive, Image* image, const TextureOptions& textureOptions,
+            TextureRegistry* textureRegistry = nullptr) {
+            Material material = {};
+            glm::vec4 baseColor(1.0f);
+            float metallic = 1.0f, roughness = 1.0f;
+            const JsonValue* baseColorTexture = nullptr;
+
+            if (primitive.Find("material")) {
+                const JsonValue& gltfMaterial = file.Element("materials", file.ReadIndexMember(primitive, "material", SIZE_MAX));
+                const JsonValue* name = gltfMaterial.Find("name");
+                if (name && name->IsString())
+                    material.name = name->String();
+
+                const JsonValue* pbr = gltfMaterial.Find("pbrMetallicRoughness");
+                if (pbr) {
+                    const JsonValue* factor = pbr->Find("baseColorFactor");
+                    if (factor && factor->IsArray() && factor->Size() == 4) {
+                        for (int c = 0; c < 4; ++c)
+                            baseColor[c] = static_cast<float>(factor->At(static_cast<size_t>(c)).Number());
+                    }
+                    metallic = static_cast<float>(pbr->NumberOr("metallicFactor", 1.0));
+                    roughness = static_cast<float>(pbr->NumberOr("roughnessFactor", 1.0));
+                    baseColorTexture = pbr->Find("baseColorTexture");
+                }
+            }
+
+            glm::vec3 color(baseColor);
+            material.diffuse = color * (1.0f - metallic);
+            material.ambient = color * GLTF_AMBIENT;
+            material.specular = glm::mix(glm::vec3(0.04f), color, metallic);
+            float alpha = std::max(roughness * roughness, 1e-3f);
+            material.shininess = glm::clamp(2.0f / (alpha * alpha) - 2.0f, 0.0f, 128.0f);
+
+            if (baseColorTexture) {
+                const JsonValue& texture = file.Element("textures", file.ReadIndexMember(*baseColorTexture, "index", SIZE_MAX));
+                const JsonValue& gltfImage = file.Element("images", file.ReadIndexMember(texture, "source", SIZE_MAX));
+                const JsonValue* uri = gltfImage.Find("uri");
+
+                if (uri && uri->IsString()) {
+                    //External Images are Relative to the glTF File
+                    size_t folderEnd = file.Path().find_last_of("/\\");
+                    material.textureFile = (folderEnd == std::string::npos ? "" : file.Path().substr(0, folderEnd + 1)) + uri->String();
+                    if (image && (!textureRegistry || textureRegistry->Claim(material.textureFile)))
+                        *image = DecodeTexture(material, textureOptions);
+                }
+                else {
+                    //Embedded Images are Decoded Straight from the Mapping, their Texture Cache is Named after the glTF File
+                    material.textureFile = file.Path();
+                    std::string_view bytes = file.GetBufferView(file.ReadIndexMember(gltfImage, "bufferView", SIZE_MAX));
+                    if (image && (!textureRegistry || textureRegistry->Claim(material.textureFile)))
+                        *image = ImportTexture(bytes.data(), bytes.size(), material.textureFile, textureOptions, 3);
+                }
+            }
+            return material;
+        }
+
+        //Version of the Mesh Cache Layout, Bumped whenever the Layout or the Parser Output Changes
+        static constexpr uint32_t MESH_CACHE_VERSION = 9;
+
+        //Vertex and Index Sections Smaller than this are Stored Raw, a Warm Load Copies them Faster than it Decodes them,
+        //and the Bytes they would Save on a Cold Read are Few
+        static constexpr uint64_t MESH_CACHE_RAW_SIZE = 1 << 20;
+
+        //Source Stamp Struct will be used to Detect when the Source File of a Cached Mesh Changes
+        struct SourceStamp {
+            uint64_t size = 0;
+            int64_t modified = 0;
+            uint64_t hash = 0;
+        };
+
+        //Mesh Cache Header Struct is the Start of every .p3dmesh File, Followed by the Vertices, the Indices, the Levels of Detail,
+        //the Meshlets, the Submeshes, the Tangents (if they were Generated) and the Material. The Vertices and Indices are
+        //MeshCodec Streams, LZ4 Compressed, unless they are Smaller than MESH_CACHE_RAW_SIZE. Those are Stored Raw, with a
+        //Stream Size of 0
+        struct MeshCacheHeader {
+            char magic[8];
+            uint32_t version;
+            uint32_t vertexStride;
+            SourceStamp objStamp;
+            SourceStamp mtlStamp;
+            uint64_t vertexCount;
+            uint64_t indexCount;
+            uint64_t vertexOffset;
+            uint64_t vertexSize;
+            uint64_t vertexStreamSize;
+            uint64_t indexOffset;
+            uint64_t indexSize;
+            uint64_t indexStreamSize;
+            uint64_t lodCount;
+            uint64_t lodOffset;
+            uint64_t meshletCount;
+            uint64_t meshletOffset;
+            uint64_t submeshCount;
+            uint64_t submeshOffset;
+            uint64_t tangentCount;
+            uint64_t tangentOffset;
+            uint64_t materialOffset;
+            uint64_t materialSize;
+        };
+
+        /**
+         * @brief MeshCachePath - The Path of the Mesh Cache of an OBJ File
+         *
+         * @param ObjPath : The Path of the OBJ File
+         * @param CacheFolder : The Folder of the Mesh Caches (Empty Stores them Next to the OBJ File)
+         * @return : The Path of the .p3dmesh File
+         */
+        static std::string MeshCachePath(const std::string& obj_model_filepath, const std::string& cacheFolder) {
+            std::filesystem::path cachePath(obj_model_filepath);
+            cachePath.replace_extension(".p3dmesh");
+            if (!cacheFolder.empty())
+                cachePath = std::filesystem::path(cacheFolder) / cachePath.filename();
+            return cachePath.string();
+        }
+
+        /**
+         * @brief StampSource - Records the Size, Modification Time and Content Hash of a Source File
+         *
+         * @param Path : The Path of the Source File
+         * @return : The Stamp, with a Size of UINT64_MAX if the File doesn't Exist
+         */
+        static SourceStamp StampSource(const std::string& path) {
+            SourceStamp stamp;
+            std::error_code error;
+            std::filesystem::file_time_type modified = std::filesystem::last_write_time(path, error);
+            MappedFile file(path);
+            if (error || !file.IsOpen()) {
+                stamp.size = UINT64_MAX;
+                return stamp;
+            }
+            stamp.size = file.Size();
+            stamp.modified = static_cast<int64_t>(modified.time_since_epoch().count());
+            stamp.hash = HashBytes(file.Begin(), file.Size());
+            return stamp;
+        }
+
+        /**
+         * @brief IsSourceCurrent - Checks if a Source File Still Matches its Stamp
+         *
+         * Size and Modification Time are Checked First, the Contents are Only Hashed when the Time Changed.
+         *
+         * @param Path : The Path of the Source File
+         * @param Stamp : The Stamp Recorded when the Cache was Written
+         * @return : True if the Source is Unchanged
+         */
+        static bool IsSourceCurrent(const std::string& path, const SourceStamp& stamp) {
+            std::error_code error;
+            uint64_t size = std::filesystem::file_size(path, error);
+            if (error)
+                return stamp.size == UINT64_MAX;
+            if (size != stamp.size)
+                return false;
+
+            std::filesystem::file_time_type modified = std::filesystem::last_write_time(path, error);
+            if (!error && static_cast<int64_t>(modified.time_since_epoch().count()) == stamp.modified)
+                return true;
+
+            //Touched but Possibly not Edited
+            MappedFile file(path);
+            return file.IsOpen() && file.Size() == stamp.size && HashBytes(file.Begin(), file.Size()) == stamp.hash;
+        }
+
+        /**
+         * @brief ReadMeshCache - Loads an Object from its Mesh Cache without Parsing
+         *
+         * @param CachePath : The Path of the .p3dmesh File
+         * @param ObjPath : The Path of the OBJ File the Cache was Built from
+         * @param Folder : The Folder of the Files
+         * @param ObjectData : Receives the Object Mesh and Materials
+         * @param MeshOptions : Which Optional Data the Mesh Needs, a Cache Built with Other Options is Stale
+         * @return : False if the Cache is Missing, Corrupt or Stale
+         */
+        static bool ReadMeshCache(const std::string& cachePath, const std::string& obj_model_filepath, const std::string& obj_model_folderpath, ObjectData& objectData,
+            const MeshOptions& meshOptions = MeshOptions()) {
+            MappedFile cacheFile(cachePath);
+            if (!cacheFile.IsOpen() || cacheFile.Size() < sizeof(MeshCacheHeader))
+                return false;
+
+            MeshCacheHeader header;
+            std::memcpy(&header, cacheFile.Begin(), sizeof(header));
+            if (std::memcmp(header.magic, "P3DMESH", 8) != 0 || header.version != MESH_CACHE_VERSION || header.vertexStride != sizeof(Vertex))
+                return false;
+
+            //Every Section Must Lie Inside the File
+            uint64_t fileSize = cacheFile.Size();
+            if (header.vertexOffset > fileSize || header.vertexSize > fileSize - header.vertexOffset ||
+                header.indexOffset > fileSize || header.indexSize > fileSize - header.indexOffset ||
+                header.lodOffset > fileSize || header.lodCount == 0 || header.lodCount > (fileSize - header.lodOffset) / sizeof(Lod) ||
+                header.meshletOffset > fileSize || header.meshletCount > (fileSize - header.meshletOffset) / sizeof(Meshlet) ||
+                header.submeshOffset > fileSize || header.submeshCount > (fileSize - header.submeshOffset) / sizeof(Submesh) ||
+                (header.tangentCount != 0 && header.tangentCount != header.vertexCount) ||
+                header.tangentOffset > fileSize || header.tangentCount > (fileSize - header.tangentOffset) / sizeof(glm::vec4) ||
+                header.materialOffset > fileSize || header.materialSize > fileSize - header.materialOffset)
+                return false;
+
+            //Tangents Must be Present Exactly when they are Asked for
+            if ((header.tangentCount != 0) != (meshOptions.generateTangents && header.vertexCount != 0))
+                return false;
+
+            //The Material Section Holds the MTL File String, then each Material's Coefficients, Name and Texture
+            //Strings, then the Names the OBJ File Gave the Materials
+            const char* cursor = cacheFile.Begin() + header.materialOffset;
+            const char* end = cursor + header.materialSize;
+            std::string mtlFileName;
+            if (!ReadCacheString(cursor, end, mtlFileName))
+                return false;
+
+            //The Cache is Stale if Either Source Changed since it was Written
+            if (!IsSourceCurrent(obj_model_filepath, header.objStamp) ||
+                !IsSourceCurrent(MaterialFolder(obj_model_folderpath) + mtlFileName, header.mtlStamp))
+                return false;
+
+            uint32_t materialCount;
+            if (!ReadCacheBytes(cursor, end, &materialCount, sizeof(materialCount)) || materialCount == 0 || materialCount > header.materialSize)
+                return false;
+            std::vector<Material> materials(materialCount);
+            for (Material& material : materials) {
+                std::string textureFileName;
+                float coefficients[10];
+                if (!ReadCacheBytes(cursor, end, coefficients, sizeof(coefficients)) ||
+                    !ReadCacheString(cursor, end, material.name) ||
+                    !ReadCacheString(cursor, end, textureFileName))
+                    return false;
+
+                material.ambient = glm::vec3(coefficients[0], coefficients[1], coefficients[2]);
+                material.diffuse = glm::vec3(coefficients[3], coefficients[4], coefficients[5]);
+                material.specular = glm::vec3(coefficients[6], coefficients[7], coefficients[8]);
+                material.shininess = coefficients[9];
+                if (!textureFileName.empty())
+                    material.textureFile = MaterialFolder(obj_model_folderpath) + textureFileName;
+            }
+
+            uint32_t nameCount;
+            if (!ReadCacheBytes(cursor, end, &nameCount, sizeof(nameCount)) || nameCount > header.materialSize)
+                return false;
+
+            //The Vertices and Indices are Decoded Straight into the Buffers Send Uploads
+            Mesh mesh;
+            mesh.materialNames.resize(nameCount);
+            for (std::string& name : mesh.materialNames) {
+                if (!ReadCacheString(cursor, end, name))
+                    return false;
+            }
+            std::string stream;
+            if (header.vertexStreamSize == 0) {
+                if (!ReadRawCacheSection(cacheFile.Begin() + header.vertexOffset, header.vertexSize, header.vertexCount, mesh.vertices))
+                    return false;
+            }
+            else {
+                if (!ReadCacheStream(cacheFile.Begin() + header.vertexOffset, header.vertexSize, header.vertexStreamSize, header.vertexCount, sizeof(Vertex), stream))
+                    return false;
+                mesh.vertices.resize(static_cast<size_t>(header.vertexCount));
+                if (!MeshCodec::DecodeVertices(mesh.vertices.data(), mesh.vertices.size(), sizeof(Vertex), stream.data(), stream.size()))
+                    return false;
+            }
+            if (header.indexStreamSize == 0) {
+                if (!ReadRawCacheSection(cacheFile.Begin() + header.indexOffset, header.indexSize, header.indexCount, mesh.indices))
+                    return false;
+            }
+            else {
+                if (!ReadCacheStream(cacheFile.Begin() + header.indexOffset, header.indexSize, header.indexStreamSize, header.indexCount, sizeof(GLuint), stream))
+                    return false;
+                mesh.indices.resize(static_cast<size_t>(header.indexCount));
+                if (!MeshCodec::DecodeIndices(mesh.indices.data(), mesh.indices.size(), stream.data(), stream.size()))
+                    return false;
+            }
+
+            //Indices Reach the GPU Unchecked, so a Corrupt Cache Mustn't Point Past the Vertices
+            for (GLuint index : mesh.indices) {
+                if (index >= mesh.vertices.size())
+                    return false;
+            }
+            mesh.lods.resize(static_cast<size_t>(header.lodCount));
+            std::memcpy(mesh.lods.data(), cacheFile.Begin() + header.lodOffset, mesh.lods.size() * sizeof(Lod));
+            mesh.meshlets.resize(static_cast<size_t>(header.meshletCount));
+            if (!mesh.meshlets.empty())
+                std::memcpy(mesh.meshlets.data(), cacheFile.Begin() + header.meshletOffset, mesh.meshlets.size() * sizeof(Meshlet));
+            mesh.submeshes.resize(static_cast<size_t>(header.submeshCount));
+            if (!mesh.submeshes.empty())
+                std::memcpy(mesh.submeshes.data(), cacheFile.Begin() + header.submeshOffset, mesh.submeshes.size() * sizeof(Submesh));
+            mesh.tangents.resize(static_cast<size_t>(header.tangentCount));
+            if (!mesh.tangents.empty())
+                std::memcpy(mesh.tangents.data(), cacheFile.Begin() + header.tangentOffset, mesh.tangents.size() * sizeof(glm::vec4));
+            for (const Lod& lod : mesh.lods) {
+                if (lod.indexOffset > mesh.indices.size() || lod.indexCount > mesh.indices.size() - lod.indexOffset ||
+                    lod.meshletOffset > mesh.meshlets.size() || lod.meshletCount > mesh.meshlets.size() - lod.meshletOffset ||
+                    lod.submeshOffset > mesh.submeshes.size() || lod.submeshCount > mesh.submeshes.size() - lod.submeshOffset)
+                    return false;
+            }
+            for (const Submesh& submesh : mesh.submeshes) {
+                if (submesh.material >= materials.size() ||
+                    submesh.indexOffset > mesh.indices.size() || submesh.indexCount > mesh.indices.size() - submesh.indexOffset ||
+                    submesh.meshletOffset > mesh.meshlets.size() || submesh.meshletCount > mesh.meshlets.size() - submesh.meshletOffset)
+                    return false;
+            }
+            for (const Meshlet& meshlet : mesh.meshlets) {
+                if (meshlet.indexOffset > mesh.indices.size() || meshlet.indexCount > mesh.indices.size() - meshlet.indexOffset)
+                    return false;
+            }
+
+            objectData = std::make_pair(std::make_shared<const Mesh>(std::move(mesh)), std::move(materials));
+            return true;
+        }
+
         /**
-         * @brief LoadTextures - Load Textures Loads the Textures
+         * @brief WriteMeshCache - Writes the Mesh Cache of an Object, Failures are Reported but not Fatal
          *
-         * @param ObjectData : The Object Data
+         * @param CachePath : The Path of the .p3dmesh File
+         * @param ObjPath : The Path of the OBJ File the Object was Parsed from
+         * @param Folder : The Folder of the Files
+         * @param MtlFileName : The Name of the MTL File the OBJ File References
+         * @param ObjectData : The Object Mesh and Materials
          * @return : Void
          */
-        static void LoadTextures(std::vector<std::pair<std::vector<Vertex>, Material>>* objDataList) {
-            for (auto& objectData : *objDataList) {
-                //The Material of the Object Data
-                Material& material = objectData.second;
+        static void WriteMeshCache(const std::string& cachePath, const std::string& obj_model_filepath, const std::string& obj_model_folderpath, const std::string& mtlFileName, const ObjectData& objectData) {
+            const Mesh& mesh = *objectData.first;
+            const std::vector<Material>& materials = objectData.second;
+            std::string materialFolder = MaterialFolder(obj_model_folderpath);
+
+            std::string materialBlock;
+            WriteCacheString(materialBlock, mtlFileName);
+            uint32_t materialCount = static_cast<uint32_t>(materials.size());
+            materialBlock.append(reinterpret_cast<const char*>(&materialCount), sizeof(materialCount));
+            for (const Material& material : materials) {
+                //Texture Paths are Stored Relative to the Folder, so the Cache Survives a Different Working Directory
+                std::string textureFileName = material.textureFile;
+                if (textureFileName.compare(0, materialFolder.size(), materialFolder) == 0)
+                    textureFileName.erase(0, materialFolder.size());
+
+                float coefficients[10] = {
+                    material.ambient.r, material.ambient.g, material.ambient.b,
+                    material.diffuse.r, material.diffuse.g, material.diffuse.b,
+                    material.specular.r, material.specular.g, material.specular.b,
+                    material.shininess
+                };
+                materialBlock.append(reinterpret_cast<const char*>(coefficients), sizeof(coefficients));
+                WriteCacheString(materialBlock, material.name);
+                WriteCacheString(materialBlock, textureFileName);
+            }
+            uint32_t nameCount = static_cast<uint32_t>(mesh.materialNames.size());
+            materialBlock.append(reinterpret_cast<const char*>(&nameCount), sizeof(nameCount));
+            for (const std::string& name : mesh.materialNames)
+                WriteCacheString(materialBlock, name);
+
+            MeshCacheHeader header = {};
+            std::memcpy(header.magic, "P3DMESH", 8);
+            header.version = MESH_CACHE_VERSION;
+            header.vertexStride = sizeof(Vertex);
+            header.objStamp = StampSource(obj_model_filepath);
+            header.mtlStamp = StampSource(materialFolder + mtlFileName);
+            header.vertexCount = mesh.vertices.size();
+            header.indexCount = mesh.indices.size();
+            header.lodCount = mesh.lods.size();
+            header.meshletCount = mesh.meshlets.size();
+            header.submeshCount = mesh.submeshes.size();
+            header.tangentCount = mesh.tangents.size();
+
+            //Small Sections are Stored Raw and Keep a Stream Size of 0
+            std::string vertexBlock, indexBlock;
+            if (mesh.vertices.size() * sizeof(Vertex) < MESH_CACHE_RAW_SIZE) {
+                vertexBlock.assign(reinterpret_cast<const char*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(Vertex));
+            }
+            else {
+                header.vertexStreamSize = WriteCacheStream(vertexBlock, [&mesh](std::string& stream) {
+                    MeshCodec::EncodeVertices(mesh.vertices.data(), mesh.vertices.size(), sizeof(Vertex), stream);
+                });
+            }
+            if (mesh.indices.size() * sizeof(GLuint) < MESH_CACHE_RAW_SIZE) {
+                indexBlock.assign(reinterpret_cast<const char*>(mesh.indices.data()), mesh.indices.size() * sizeof(GLuint));
+            }
+            else {
+                header.indexStreamSize = WriteCacheStream(indexBlock, [&mesh](std::string& stream) {
+                    MeshCodec::EncodeIndices(mesh.indices.data(), mesh.indices.size(), stream);
+                });
+            }
+            header.vertexSize = vertexBlock.size();
+            header.indexSize = indexBlock.size();
+
+            //Sections Start on 16 Byte Boundaries so the Fixed Size Records can be Copied Straight from the Mapping
+            auto align = [](uint64_t offset) { return (offset + 15) & ~uint64_t(15); };
+            header.vertexOffset = align(sizeof(MeshCacheHeader));
+            header.indexOffset = align(header.vertexOffset + header.vertexSize);
+            header.lodOffset = align(header.indexOffset + header.indexSize);
+            header.meshletOffset = align(header.lodOffset + mesh.lods.size() * sizeof(Lod));
+            header.submeshOffset = align(header.meshletOffset + mesh.meshlets.size() * sizeof(Meshlet));
+            header.tangentOffset = align(header.submeshOffset + mesh.submeshes.size() * sizeof(Submesh));
+            header.materialOffset = align(header.tangentOffset + mesh.tangents.size() * sizeof(glm::vec4));
+            header.materialSize = materialBlock.size();
+
+            std::string contents(static_cast<size_t>(header.materialOffset + header.materialSize), '\0');
+            std::memcpy(&contents[0], &header, sizeof(header));
+            std::memcpy(&contents[static_cast<size_t>(header.vertexOffset)], vertexBlock.data(), vertexBlock.size());
+            std::memcpy(&contents[static_cast<size_t>(header.indexOffset)], indexBlock.data(), indexBlock.size());
+            std::memcpy(&contents[static_cast<size_t>(header.lodOffset)], mesh.lods.data(), mesh.lods.size() * sizeof(Lod));
+            if (!mesh.meshlets.empty())
+                std::memcpy(&contents[static_cast<size_t>(header.meshletOffset)], mesh.meshlets.data(), mesh.meshlets.size() * sizeof(Meshlet));
+            if (!mesh.submeshes.empty())
+                std::memcpy(&contents[static_cast<size_t>(header.submeshOffset)], mesh.submeshes.data(), mesh.submeshes.size() * sizeof(Submesh));
+            if (!mesh.tangents.empty())
+                std::memcpy(&contents[static_cast<size_t>(header.tangentOffset)], mesh.tangents.data(), mesh.tangents.size() * sizeof(glm::vec4));
+            std::memcpy(&contents[static_cast<size_t>(header.materialOffset)], materialBlock.data(), materialBlock.size());
+
+            if (!WriteCacheFile(cachePath, contents))
+                std::cerr << "Failed to write mesh cache: " << cachePath << std::endl;
+        }
 
-                //Loads the Texture Image
-                int width, height, channels;
-                unsigned char* image = stbi_load(material.textureFile.c_str(), &width, &height, &channels, 0);
+        //Version of the Texture Cache Layout, Bumped whenever the Layout or the Block Encoder Output Changes
+        static constexpr uint32_t TEXTURE_CACHE_VERSION = 1;
+
+        //Texture Cache Header Struct is the Start of every .p3dtex File, Followed by a Cooked Level Record per Mip Level and
+        //then the Blocks of all Levels, which Load in a Single Copy
+        struct TextureCacheHeader {
+            char magic[8];
+            uint32_t version;
+            uint32_t compression;
+            uint32_t quality;
+            uint32_t format;
+            uint64_t sourceHash;
+            uint64_t sourceSize;
+            uint32_t width;
+            uint32_t height;
+            uint32_t channels;
+            uint32_t levelCount;
+            uint64_t blockOffset;
+            uint64_t blockSize;
+        };
 
-                //Check's if there were an error in the Loading of the Texture Image
-                if (!image) {
-                    std::cerr << "Failed to load texture image: " << material.textureFile << std::endl;
-                    return;
-                }
+        /**
+         * @brief TextureCachePath - The Path of the Texture Cache of an Image File
+         *
+         * The Name Carries a Hash of the Image Contents and the Options, so an Edited Image or Other Options
+         * Cook a New Cache instead of Reading a Stale One. Old Caches are Left Behind.
+         *
+         * @param TextureFile : The Path of the Image File
+         * @param SourceHash : The Hash of the Image File
+         * @param TextureOptions : The Format and Quality, and the Folder of the Texture Caches (Empty Stores them Next to the Image File)
+         * @return : The Path of the .p3dtex File
+         */
+        static std::string TextureCachePath(const std::string& textureFile, uint64_t sourceHash, const TextureOptions& textureOptions) {
+            uint32_t settings[2] = { static_cast<uint32_t>(textureOptions.compression), static_cast<uint32_t>(textureOptions.quality) };
+            uint64_t key = HashBytes(settings, sizeof(settings), sourceHash);
+            char hex[16];
+            std::to_chars_result written = std::to_chars(hex, hex + sizeof(hex), key, 16);
+
+            std::filesystem::path cachePath(textureFile);
+            std::string fileName = cachePath.stem().string() + "." + std::string(hex, written.ptr) + ".p3dtex";
+            if (!textureOptions.cacheFolder.empty())
+                return (std::filesystem::path(textureOptions.cacheFolder) / fileName).string();
+            return cachePath.replace_filename(fileName).string();
+        }
 
-                //Generate the Texture ID
-                GLuint textureID;
-                glGenTextures(1, &textureID);
+        /**
+         * @brief ReadTextureCache - Loads the Cooked Blocks of a Texture without Decoding its Image File
+         *
+         * @param CachePath : The Path of the .p3dtex File
+         * @param SourceHash : The Hash of the Image File
+         * @param SourceSize : The Size of the Image File
+         * @param TextureOptions : The Format and Quality the Blocks Must have been Cooked with
+         * @param Image : Receives the Compressed Image
+         * @return : False if the Cache is Missing, Corrupt or Cooked from Something Else
+         */
+        static bool ReadTextureCache(const std::string& cachePath, uint64_t sourceHash, uint64_t sourceSize, const TextureOptions& textureOptions, Image& image) {
+            MappedFile cacheFile(cachePath);
+            if (!cacheFile.IsOpen() || cacheFile.Size() < sizeof(TextureCacheHeader))
+                return false;
+
+            TextureCacheHeader header;
+            std::memcpy(&header, cacheFile.Begin(), sizeof(header));
+            BlockEncoder::Format format = static_cast<BlockEncoder::Format>(header.format);
+            bool formatMatches = format == textureOptions.compression ||
+                (textureOptions.compression == BlockEncoder::Format::BC1 && format == BlockEncoder::Format::BC3);
+            if (std::memcmp(header.magic, "P3DTEX", 7) != 0 || header.version != TEXTURE_CACHE_VERSION ||
+                header.compression != static_cast<uint32_t>(textureOptions.compression) || header.quality != static_cast<uint32_t>(textureOptions.quality) ||
+                !formatMatches || header.sourceHash != sourceHash || header.sourceSize != sourceSize ||
+                header.channels < 1 || header.channels > 4 || header.width == 0 || header.height == 0 ||
+                header.levelCount != static_cast<uint32_t>(Mipmaps::LevelCount(static_cast<int>(header.width), static_cast<int>(header.height))))
+                return false;
+
+            //The Level Records and the Blocks Must Lie Inside the File, and each Level Must Hold Exactly its Blocks
+            uint64_t fileSize = cacheFile.Size();
+            uint64_t recordsEnd = sizeof(TextureCacheHeader) + static_cast<uint64_t>(header.levelCount) * sizeof(CookedLevel);
+            if (recordsEnd > fileSize || header.blockOffset < recordsEnd || header.blockOffset > fileSize || header.blockSize > fileSize - header.blockOffset)
+                return false;
+            std::vector<CookedLevel> levels(header.levelCount);
+            std::memcpy(levels.data(), cacheFile.Begin() + sizeof(TextureCacheHeader), levels.size() * sizeof(CookedLevel));
+            for (uint32_t l = 0; l < header.levelCount; ++l) {
+                const CookedLevel& level = levels[l];
+                if (level.width != std::max(1u, header.width >> l) || level.height != std::max(1u, header.height >> l) ||
+                    level.size != BlockEncoder::EncodedSize(static_cast<int>(level.width), static_cast<int>(level.height), format) ||
+                    level.offset > header.blockSize || level.size > header.blockSize - level.offset)
+                    return false;
+            }
+
+            image.width = static_cast<int>(header.width);
+            image.height = static_cast<int>(header.height);
+            image.channels = static_cast<int>(header.channels);
+            image.compression = format;
+            image.levels = std::move(levels);
+            const unsigned char* blocks = reinterpret_cast<const unsigned char*>(cacheFile.Begin()) + header.blockOffset;
+            image.blocks.assign(blocks, blocks + header.blockSize);
+            return true;
+        }
+
+        /**
+         * @brief WriteTextureCache - Writes the Texture Cache of a Compressed Image, Failures are Reported but not Fatal
+         *
+         * @param CachePath : The Path of the .p3dtex File
+         * @param SourceHash : The Hash of the Image File
+         * @param SourceSize : The Size of the Image File
+         * @param TextureOptions : The Format and Quality the Blocks were Cooked with
+         * @param Image : The Compressed Image
+         * @return : Void
+         */
+        static void WriteTextureCache(const std::string& cachePath, uint64_t sourceHash, uint64_t sourceSize, const TextureOptions& textureOptions, const Image& image) {
+            TextureCacheHeader header = {};
+            std::memcpy(header.magic, "P3DTEX", 7);
+            header.version = TEXTURE_CACHE_VERSION;
+            header.compression = static_cast<uint32_t>(textureOptions.compression);
+            header.quality = static_cast<uint32_t>(textureOptions.quality);
+            header.format = static_cast<uint32_t>(image.compression);
+            header.sourceHash = sourceHash;
+            header.sourceSize = sourceSize;
+            header.width = static_cast<uint32_t>(image.width);
+            header.height = static_cast<uint32_t>(image.height);
+            header.channels = static_cast<uint32_t>(image.channels);
+            header.levelCount = static_cast<uint32_t>(image.levels.size());
+
+            //Blocks Start on a 16 Byte Boundary, like the Sections of a Mesh Cache
+            uint64_t recordsEnd = sizeof(TextureCacheHeader) + image.levels.size() * sizeof(CookedLevel);
+            header.blockOffset = (recordsEnd + 15) & ~uint64_t(15);
+            header.blockSize = image.blocks.size();
+
+            std::string contents(static_cast<size_t>(header.blockOffset + header.blockSize), '\0');
+            std::memcpy(&contents[0], &header, sizeof(header));
+            std::memcpy(&contents[sizeof(header)], image.levels.data(), image.levels.size() * sizeof(CookedLevel));
+            std::memcpy(&contents[static_cast<size_t>(header.blockOffset)], image.blocks.data(), image.blocks.size());
+
+            if (!WriteCacheFile(cachePath, contents))
+                std::cerr << "Failed to write texture cache: " << cachePath << std::endl;
+        }
 
-                //Activate the desired texture unit
-                //glActiveTexture(GL_TEXTURE0 + textureID);
+        /**
+         * @brief WriteCacheFile - Writes a Cache through a Temporary File, so a Reader Never Sees a Partial Cache
+         *
+         * @param CachePath : The Path of the Cache, whose Folder is Created if Needed
+         * @param Contents : The Bytes of the Cache
+         * @return : False if the File couldn't be Written
+         */
+        static bool WriteCacheFile(const std::string& cachePath, const std::string& contents) {
+            std::error_code error;
+            std::filesystem::path parentFolder = std::filesystem::path(cachePath).parent_path();
+            if (!parentFolder.empty())
+                std::filesystem::create_directories(parentFolder, error);
+
+            //Loaders Cooking the Same Cache at Once Each Write their own Temporary File
+            return Archive::WriteReplacing(cachePath, contents);
+        }
 
-                //Bind The Texture
-                glBindTexture(GL_TEXTURE_2D, textureID);
+        /**
+         * @brief ReadCacheStream - Decompresses the LZ4 Block of a MeshCodec Stream from a Cache Section
+         *
+         * @param Stored : The Section
+         * @param StoredSize : The Size of the Section
+         * @param StreamSize : The Size of the Stream
+         * @param RecordCount : The Number of Records the Stream Decodes to
+         * @param RecordSize : The Size of a Record
+         * @param Stream : Receives the Stream
+         * @return : False if the Sizes don't Fit Together or the Block is Corrupt
+         */
+        static bool ReadCacheStream(const char* stored, uint64_t storedSize, uint64_t streamSize, uint64_t recordCount, size_t recordSize, std::string& stream) {
+            //Bounds the Sizes before Allocating, so a Corrupt Header can't Ask for Huge Buffers
+            if (streamSize / Archive::LZ4_MAX_RATIO > storedSize || recordCount > MeshCodec::MaxRecordCount(static_cast<size_t>(streamSize), recordSize))
+                return false;
+            stream.resize(static_cast<size_t>(streamSize));
+            return Lz4Decompress(stored, static_cast<size_t>(storedSize), &stream[0], stream.size());
+        }
 
-                //Set The Texture Parameters
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        /**
+         * @brief ReadRawCacheSection - Copies the Records of a Cache Section Stored Raw
+         *
+         * @param Stored : The Section
+         * @param StoredSize : The Size of the Section
+         * @param RecordCount : The Number of Records in the Section
+         * @param Records : Receives the Records
+         * @return : False if the Section isn't the Size of the Records
+         */
+        template<typename Record>
+        static bool ReadRawCacheSection(const char* stored, uint64_t storedSize, uint64_t recordCount, std::vector<Record>& records) {
+            if (storedSize % sizeof(Record) != 0 || storedSize / sizeof(Record) != recordCount)
+                return false;
+            records.resize(static_cast<size_t>(recordCount));
+            if (!records.empty())
+                std::memcpy(records.data(), stored, static_cast<size_t>(storedSize));
+            return true;
+        }
 
-                //Loads the Texture Image Data
-                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, image);
+        /**
+         * @brief WriteCacheStream - Builds the LZ4 Block of a MeshCodec Stream for a Cache Section
+         *
+         * @param Block : Receives the Section
+         * @param Encode : Writes the Stream into the String it is Given
+         * @return : The Size of the Stream
+         */
+        template<typename Encoder>
+        static uint64_t WriteCacheStream(std::string& block, const Encoder& encode) {
+            std::string stream;
+            encode(stream);
+            Lz4Compress(stream.data(), stream.size(), block);
+            return stream.size();
+        }
 
-                //Enables the Texture Mapping
-                glEnable(GL_TEXTURE_2D);
+        /**
+         * @brief ReadCacheBytes - Reads a Fixed Size Block from a Cache Section
+         *
+         * @param Cursor : The Read Position, Advanced Past the Block
+         * @param End : The End of the Section
+         * @param Destination : Receives the Bytes
+         * @param Size : The Number of Bytes
+         * @return : False if the Section is too Short
+         */
+        static bool ReadCacheBytes(const char*& cursor, const char* end, void* destination, size_t size) {
+            if (static_cast<size_t>(end - cursor) < size)
+                return false;
+            std::memcpy(destination, cursor, size);
+            cursor += size;
+            return true;
+        }
 
-                //Bind the Texture to the Object
-                material.textureID = textureID;
+        /**
+         * @brief ReadCacheString - Reads a Length Prefixed String from a Cache Section
+         *
+         * @param Cursor : The Read Position, Advanced Past the String
+         * @param End : The End of the Section
+         * @param Value : Receives the String
+         * @return : False if the Section is too Short
+         */
+        static bool ReadCacheString(const char*& cursor, const char* end, std::string& value) {
+            uint32_t length;
+            if (!ReadCacheBytes(cursor, end, &length, sizeof(length)) || static_cast<size_t>(end - cursor) < length)
+                return false;
+            value.assign(cursor, length);
+            cursor += length;
+            return true;
+        }
 
-                //Free the Image Data
-                stbi_image_free(image);
-            }
+        /**
+         * @brief WriteCacheString - Appends a Length Prefixed String to a Cache Section
+         *
+         * @param Block : The Section being Built
+         * @param Value : The String
+         * @return : Void
+         */
+        static void WriteCacheString(std::string& block, const std::string& value) {
+            uint32_t length = static_cast<uint32_t>(value.size());
+            block.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            block.append(value);
         }
 
         /**
-         * @brief Read - Reads the Files and Creates a List of Object Data
+         * @brief FindLineEnd - Finds the End of the Current Line
          *
-         * @param Folder : The Folder of the Files
-         * @return : Object Data List
+         * @param Cursor : The Start of the Line
+         * @param End : The End of the Buffer
+         * @return : Pointer to the '\n' or to the End of the Buffer
          */
-        static std::vector<std::pair<std::vector<Vertex>, Material>> Read(const std::string& obj_model_folderpath) {
+        static const char* FindLineEnd(const char* cursor, const char* end) {
+            const void* newLine = std::memchr(cursor, '\n', static_cast<size_t>(end - cursor));
+            return newLine ? static_cast<const char*>(newLine) : end;
+        }
 
-            //The List of Objects that will be Populated with the Objects Vertices and Material
-            std::vector<std::pair<std::vector<Vertex>, Material>> objDataList;
-
-            for (size_t i = 1; i < 16; ++i) {
-                std::string obj_model_filepath = obj_model_folderpath + "Ball" + std::to_string(i) + ".obj";
-                std::string mtlFileName;
-                std::ifstream objFile(obj_model_filepath);
-
-                if (!objFile) {
-                    throw std::runtime_error("Failed to open OBJ file: " + obj_model_filepath);
-                }
-
-                Material material;
-                std::vector<Vertex> vertices;
-                std::vector<glm::vec3> positions;
-                std::vector<glm::vec2> texcoords;
-                std::vector<glm::vec3> normals;
-
-                std::string line;
-                while (std::getline(objFile, line)) {
-                    std::istringstream iss(line);
-                    std::string prefix;
-                    iss >> prefix;
-
-                    if (prefix == "v") {
-                        //Vertex Position
-                        glm::vec3 position;
-                        iss >> position.x >> position.y >> position.z;
-                        positions.push_back(position);
-                    }
-                    else if (prefix == "vt") {
-                        //Vertex Texture Coordinates
-                        glm::vec2 texcoord;
-                        iss >> texcoord.x >> texcoord.y;
-                        texcoords.push_back(texcoord);
-                    }
-                    else if (prefix == "vn") {
-                        //Vetex Normal
-                        glm::vec3 normal;
-                        iss >> normal.x >> normal.y >> normal.z;
-                        normals.push_back(normal);
+        /**
+         * @brief IsBlank - Checks if a Character Separates Tokens
+         *
+         * @param Character : The Character to Check
+         * @return : True for Spaces, Tabs and Carriage Returns
+         */
+        static bool IsBlank(char character) {
+            return character == ' ' || character == '\t' || character == '\r' || character == '\v' || character == '\f';
+        }
+
+        /**
+         * @brief NextToken - Reads the Next Whitespace Separated Token, the same way "stream >> string" does
+         *
+         * @param Cursor : The Read Position, Advanced Past the Token
+         * @param End : The End of the Line
+         * @return : View of the Token, Empty if the Line has no more Tokens
+         */
+        static std::string_view NextToken(const char*& cursor, const char* end) {
+            while (cursor < end && IsBlank(*cursor))
+                ++cursor;
+            const char* tokenStart = cursor;
+            while (cursor < end && !IsBlank(*cursor))
+                ++cursor;
+            return std::string_view(tokenStart, static_cast<size_t>(cursor - tokenStart));
+        }
+
+        /**
+         * @brief ParseFloat - Parses a Decimal Number Token
+         *
+         * @param Token : The Token
+         * @param Value : The Parsed Value, Unchanged if the Token isn't a Number
+         * @return : True if a Number was Parsed
+         */
+        static bool ParseFloat(std::string_view token, float& value) {
+            const char* cursor = token.data();
+            const char* end = cursor + token.size();
+
+            //from_chars doesn't Accept an Explicit Plus Sign
+            if (cursor < end && *cursor == '+')
+                ++cursor;
+
+            return ParseDecimal(cursor, end, value).ec == std::errc();
+        }
+
+        /**
+         * @brief ParseIndex - Parses the Next Index of a Face Token, Skipping the '/' Separator Before it
+         *
+         * @param Cursor : The Read Position
+         * @param End : The End of the Face Token
+         * @param Value : The Parsed Index
+         * @return : The Read Position after the Index
+         */
+        static const char* ParseIndex(const char* cursor, const char* end, int& value) {
+            //One Separator per Field, so the Empty Texture Field of "v//vn" is Left Unset
+            if (cursor < end && *cursor == '/')
+                ++cursor;
+
+            if (cursor < end && *cursor == '+')
+                ++cursor;
+
+            bool negative = cursor < end && *cursor == '-';
+            if (negative)
+                ++cursor;
+
+            //Accumulates in 64 Bits, Indices that don't Fit an int are Rejected like std::from_chars does
+            const char* digitsStart = cursor;
+            int64_t index = 0;
+            while (cursor < end && static_cast<unsigned char>(*cursor - '0') <= 9 && index <= static_cast<int64_t>(INT_MAX) + 1) {
+                index = index * 10 + (*cursor - '0');
+                ++cursor;
+            }
+            if (cursor == digitsStart)
+                return cursor;
+            if (index > static_cast<int64_t>(INT_MAX) + negative)
+                return end;
+
+            value = static_cast<int>(negative ? -index : index);
+            return cursor;
+        }
+
+        //Index Map is an Open Addressing Hash Table from a Face Corner's v/vt/vn Triplet to its Vertex Index
+        class IndexMap {
+        public:
+            IndexMap(size_t expectedCount = 0, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+                : slots(SlotCount(expectedCount), resource) {}
+
+            /**
+             * @brief TableSize - The Bytes the Table Needs to Hold a Number of Triplets without Growing
+             *
+             * @param ExpectedCount : The Number of Triplets
+             * @return : The Size in Bytes
+             */
+            static size_t TableSize(size_t expectedCount) {
+                return SlotCount(expectedCount) * sizeof(Slot);
+            }
+
+            /**
+             * @brief FindOrInsert - Finds the Vertex Index of a Triplet, Inserting it if it is New
+             *
+             * @param Position : The Position Index of the Corner
+             * @param Texcoord : The Texture Coordinate Index of the Corner
+             * @param Normal : The Normal Index of the Corner
+             * @param NewIndex : The Vertex Index Assigned if the Triplet is New
+             * @return : The Existing Vertex Index, or NewIndex if it was Inserted
+             */
+            GLuint FindOrInsert(int position, int texcoord, int normal, GLuint newIndex) {
+                //Keeps the Load Factor Under One Half so Probe Sequences Stay Short
+                if ((count + 1) * 2 > slots.size())
+                    Grow();
+
+                size_t mask = slots.size() - 1;
+                for (size_t slot = Hash(position, texcoord, normal) & mask; ; slot = (slot + 1) & mask) {
+                    Slot& entry = slots[slot];
+                    if (entry.index == EMPTY) {
+                        entry = { position, texcoord, normal, newIndex };
+                        ++count;
+                        return newIndex;
                     }
-                    else if (prefix == "mtllib") {
-                        //Material File Name
-                        iss >> mtlFileName;
+                    if (entry.position == position && entry.texcoord == texcoord && entry.normal == normal)
+                        return entry.index;
+                }
+            }
+
+        private:
+            static constexpr GLuint EMPTY = 0xFFFFFFFFu;
+
+            struct Slot {
+                int position = 0;
+                int texcoord = 0;
+                int normal = 0;
+                GLuint index = EMPTY;
+            };
+
+            //Smallest Power of Two that Keeps the Load Factor Under One Half
+            static size_t SlotCount(size_t expectedCount) {
+                size_t slotCount = 1024;
+                while (slotCount < expectedCount * 2 + 2)
+                    slotCount *= 2;
+                return slotCount;
+            }
+
+            static size_t Hash(int position, int texcoord, int normal) {
+                uint64_t hash = static_cast<uint32_t>(position) * 0x9E3779B97F4A7C15ull;
+                hash ^= static_cast<uint32_t>(texcoord) * 0xC2B2AE3D27D4EB4Full;
+                hash ^= static_cast<uint32_t>(normal) * 0x165667B19E3779F9ull;
+                return static_cast<size_t>(hash ^ (hash >> 29));
+            }
+
+            void Grow() {
+                std::pmr::vector<Slot> oldSlots(slots.size() * 2, slots.get_allocator());
+                oldSlots.swap(slots);
+                size_t mask = slots.size() - 1;
+                for (const Slot& entry : oldSlots) {
+                    if (entry.index == EMPTY)
+                        continue;
+                    size_t slot = Hash(entry.position, entry.texcoord, entry.normal) & mask;
+                    while (slots[slot].index != EMPTY)
+                        slot = (slot + 1) & mask;
+                    slots[slot] = entry;
+                }
+            }
+
+            std::pmr::vector<Slot> slots;
+            size_t count = 0;
+        };
+
+        //Material Groups Collects the Indices of the Triangles of each Material, Materials are Numbered in Order of First Use
+        class MaterialGroups {
+        public:
+            static constexpr size_t NONE = SIZE_MAX;
+
+            //Groups of a Chunk Start with the Material the Previous Chunks Selected, which the Chunk doesn't Know
+            explicit MaterialGroups(bool inheritsMaterial = false) : inheriting(inheritsMaterial) {}
+
+            //Selects the Material of the Following Triangles, by the Name usemtl Gave it
+            void Use(std::string_view name) {
+                selectedName = name;
+                selected = NONE;
+                inheriting = false;
+                selectsMaterial = true;
+            }
+
+            //The Indices of the Selected Material, its Group is Created when the First Triangle Uses it
+            std::vector<GLuint>& Indices() {
+                if (selected == NONE) {
+                    if (inheriting) {
+                        inheritedGroup = selected = Add("");
                     }
-                    else if (prefix == "f") {
-                        //Faces
-                        std::string faceToken;
-                        while (iss >> faceToken) {
-                            std::replace(faceToken.begin(), faceToken.end(), '/', ' ');
-                            std::istringstream faceIss(faceToken);
-                            int vertexIndex, texcoordIndex, normalIndex;
-                            faceIss >> vertexIndex >> texcoordIndex >> normalIndex;
-
-                            //Creates a Vertex with the Corresponding Position, Texture Coordinates and Normal
-                            Vertex vertex;
-                            vertex.position = positions[vertexIndex - 1];
-                            vertex.texcoord = texcoords[texcoordIndex - 1];
-                            vertex.normal = normals[normalIndex - 1];
-                            vertices.emplace_back(vertex);
+                    else {
+                        for (size_t g = 0; g < names.size() && selected == NONE; ++g) {
+                            if (g != inheritedGroup && names[g] == selectedName)
+                                selected = g;
                         }
+                        if (selected == NONE)
+                            selected = Add(selectedName);
                     }
                 }
+                return groups[selected];
+            }
 
-                //Load Materials from MTL File
-                std::string mtlPath = obj_model_folderpath.substr(0, obj_model_folderpath.find_last_of('/')) + "/" + mtlFileName;
-                std::ifstream mtlFile(mtlPath);
-                if (mtlFile) {
-                    std::string mtlLine;
-                    while (std::getline(mtlFile, mtlLine)) {
-                        std::istringstream mtlIss(mtlLine);
-                        std::string mtlPrefix;
-                        mtlIss >> mtlPrefix;
+            //The First Group Takes the Capacity Reserved Here, Files Usually have one Material
+            void Reserve(size_t indexCount) { firstGroup.reserve(indexCount); }
 
-                        if (mtlPrefix == "newmtl") {
-                            //Material Name
-                            mtlIss >> material.name;
-                        }
-                        else if (mtlPrefix == "Ka") {
-                            //Ambient Reflection Coefficient
-                            mtlIss >> material.ambient.r >> material.ambient.g >> material.ambient.b;
-                        }
-                        else if (mtlPrefix == "Kd") {
-                            //Difuse Reflection coefficient
-                            mtlIss >> material.diffuse.r >> material.diffuse.g >> material.diffuse.b;
-                        }
-                        else if (mtlPrefix == "Ks") {
-                            //Specular Reflection coefficient
-                            mtlIss >> material.specular.r >> material.specular.g >> material.specular.b;
-                        }
-                        else if (mtlPrefix == "Ns") {
-                            //Specular exponent
-                            mtlIss >> material.shininess;
-                        }
-                        else if (mtlPrefix == "map_Kd") {
-                            //Material Texture
-                            mtlIss >> material.textureFile;
-                            material.textureFile = obj_model_folderpath.substr(0, obj_model_folderpath.find_last_of('/')) + "/" + material.textureFile;
-                        }
+            std::vector<std::string> names;
+            std::vector<std::vector<GLuint>> groups;
+
+            //The Group of the Triangles before the First usemtl, when the Material is Inherited
+            size_t inheritedGroup = NONE;
+
+            //The Name the Last usemtl Gave, if there was One
+            std::string selectedName;
+            bool selectsMaterial = false;
+
+        private:
+            size_t Add(const std::string& name) {
+                names.push_back(name);
+                groups.push_back(groups.empty() ? std::move(firstGroup) : std::vector<GLuint>());
+                return groups.size() - 1;
+            }
+
+            std::vector<GLuint> firstGroup;
+            size_t selected = NONE;
+            bool inheriting;
+        };
+
+        /**
+         * @brief SortByMaterial - Stores the Triangles of each Material one after the other as the Indices of a Mesh
+         *
+         * @param Mesh : Receives the Indices, and a Submesh for each Material
+         * @param Groups : The Indices of each Material, Consumed
+         * @return : Void
+         */
+        static void SortByMaterial(Mesh& mesh, std::vector<std::vector<GLuint>>& groups) {
+            mesh.submeshes.clear();
+            size_t indexCount = 0;
+            for (size_t g = 0; g < groups.size(); ++g) {
+                mesh.submeshes.push_back({ static_cast<GLuint>(g), static_cast<GLuint>(indexCount), static_cast<GLuint>(groups[g].size()) });
+                indexCount += groups[g].size();
+            }
+
+            //A Single Material Keeps its List, with the Capacity Reserved for the Levels of Detail
+            if (groups.size() == 1) {
+                mesh.indices = std::move(groups[0]);
+                return;
+            }
+            mesh.indices.clear();
+            mesh.indices.reserve(indexCount * 2);
+            for (const std::vector<GLuint>& group : groups)
+                mesh.indices.insert(mesh.indices.end(), group.begin(), group.end());
+        }
+
+        //Mesh Builder is the StreamObject Visitor that Builds an Indexed Mesh, Giving each Distinct v/vt/vn Triplet one Vertex
+        class MeshBuilder : public ObjVisitor {
+        public:
+            MeshBuilder(const ModelStatistics& statistics, std::pmr::memory_resource* arena)
+                : indexMap(statistics.vertexCount, arena), positions(arena), texcoords(arena), normals(arena) {
+                positions.reserve(statistics.positionCount);
+                texcoords.reserve(statistics.texcoordCount);
+                normals.reserve(statistics.normalCount);
+
+                //The Level of Detail Chain Adds Fewer Indices than the Full Detail Level Holds
+                mesh.vertices.reserve(statistics.vertexCount);
+                materials.Reserve(statistics.faceCount * 3 * 2);
+            }
+
+            void Position(const glm::vec3& position) { positions.push_back(position); }
+            void Texcoord(const glm::vec2& texcoord) { texcoords.push_back(texcoord); }
+            void Normal(const glm::vec3& normal) { normals.push_back(normal); }
+            void MaterialLibrary(std::string_view name) { mtlFileName = name; }
+            void UseMaterial(std::string_view name) { materials.Use(name); }
+
+            void Triangle(const FaceCorner* corners) {
+                std::vector<GLuint>& indices = materials.Indices();
+                for (int corner = 0; corner < 3; ++corner) {
+                    const FaceCorner& face = corners[corner];
+
+                    //Reuses the Vertex if this Position, Texture Coordinates and Normal Combination was Already Seen
+                    GLuint nextIndex = static_cast<GLuint>(mesh.vertices.size());
+                    GLuint index = indexMap.FindOrInsert(face.position, face.texcoord, face.normal, nextIndex);
+                    if (index == nextIndex) {
+                        //Creates a Vertex with the Corresponding Position, Texture Coordinates and Normal
+                        Vertex vertex{};
+                        vertex.position = Fetch(positions, face.position);
+                        vertex.texcoord = Fetch(texcoords, face.texcoord);
+                        vertex.normal = Fetch(normals, face.normal);
+                        mesh.vertices.emplace_back(vertex);
                     }
+                    indices.push_back(index);
                 }
-                else {
+            }
+
+            Mesh TakeMesh() {
+                mesh.materialNames = std::move(materials.names);
+                SortByMaterial(mesh, materials.groups);
+                return std::move(mesh);
+            }
+            const std::string& MaterialLibraryName() const { return mtlFileName; }
+
+        private:
+            //Omitted Elements Default to Zero, Indices Past the Elements Read so Far are an Error
+            template <typename Element>
+            static Element Fetch(const std::pmr::vector<Element>& elements, int index) {
+                if (index == FaceCorner::NONE)
+                    return Element(0.0f);
+                if (index < 0 || static_cast<size_t>(index) >= elements.size())
+                    throw std::runtime_error("OBJ face index out of range");
+                return elements[static_cast<size_t>(index)];
+            }
 
-                    std::cerr << "Failed to open MTL file: " << mtlPath << std::endl;
+            Mesh mesh;
+            std::string mtlFileName;
+            MaterialGroups materials;
+            IndexMap indexMap;
+            std::pmr::vector<glm::vec3> positions;
+            std::pmr::vector<glm::vec2> texcoords;
+            std::pmr::vector<glm::vec3> normals;
+        };
+
+        //Chunk Builder is the Visitor of one Chunk of a Concurrent Parse, it Writes the Elements into the Shared Arrays
+        //at the Chunk's Bases, and Deduplicates the Face Corners of the Chunk into Local Vertices
+        class ChunkBuilder : public ObjVisitor {
+        public:
+            ChunkBuilder(glm::vec3* positions, glm::vec2* texcoords, glm::vec3* normals, const ElementCounts& bases, const ElementCounts& limits)
+                : positions(positions), texcoords(texcoords), normals(normals), counts(bases), limits(limits) {}
+
+            void Position(const glm::vec3& position) { positions[Claim(counts.positions, limits.positions)] = position; }
+            void Texcoord(const glm::vec2& texcoord) { texcoords[Claim(counts.texcoords, limits.texcoords)] = texcoord; }
+            void Normal(const glm::vec3& normal) { normals[Claim(counts.normals, limits.normals)] = normal; }
+
+            void MaterialLibrary(std::string_view name) {
+                mtlFileName = name;
+                hasMaterialLibrary = true;
+            }
+
+            void UseMaterial(std::string_view name) { materials.Use(name); }
+
+            void Triangle(const FaceCorner* faceCorners) {
+                std::vector<GLuint>& indices = materials.Indices();
+                for (int corner = 0; corner < 3; ++corner) {
+                    const FaceCorner& face = faceCorners[corner];
+                    GLuint nextIndex = static_cast<GLuint>(corners.size());
+                    GLuint index = indexMap.FindOrInsert(face.position, face.texcoord, face.normal, nextIndex);
+                    if (index == nextIndex) {
+                        //The same Check the Sequential Parse Makes when it First Meets the Triplet
+                        Validate(face.position, counts.positions);
+                        Validate(face.texcoord, counts.texcoords);
+                        Validate(face.normal, counts.normals);
+                        corners.push_back(face);
+                    }
+                    indices.push_back(index);
                 }
+            }
 
-                //Creates a Pair of Vertices and Material, and Add it to the Object Data
-                std::pair<std::vector<Vertex>, Material> objectData = std::make_pair(vertices, material);
-                objDataList.push_back(objectData);
+            //Distinct Triplets in Order of First Use, and the Chunk's Corners as Indices into them, Grouped by Material
+            std::vector<FaceCorner> corners;
+            MaterialGroups materials{ true };
+            std::string mtlFileName;
+            bool hasMaterialLibrary = false;
+
+        private:
+            //The Counting Pass and the Parse Agree on Line Prefixes, the Check only Guards the Shared Arrays
+            static size_t Claim(int& count, int limit) {
+                if (count >= limit)
+                    throw std::logic_error("OBJ chunk holds more elements than were counted");
+                return static_cast<size_t>(count++);
             }
 
-            //Load the Textures for the Objects Data
-            LoadTextures(&objDataList);
+            static void Validate(int index, int count) {
+                if (index != FaceCorner::NONE && (index < 0 || index >= count))
+                    throw std::runtime_error("OBJ face index out of range");
+            }
 
-            return objDataList;
-        }
+            glm::vec3* positions;
+            glm::vec2* texcoords;
+            glm::vec3* normals;
+            ElementCounts counts;
+            ElementCounts limits;
+            IndexMap indexMap;
+        };
 
         /**
          * @brief CreateVertexBuffer - Creates a Vertex Buffer Obejct (VBO) and Filles it with the Given Vertex Data
          *
-         * @param Vertices : The Vector of Vertices to be Stored in the VBO
+         * @param Vertices : The Vector of Vertices to be Stored in the VBO, in any Vertex Format
          * @return : The Generated VBO
          */
-        static GLuint CreateVertexBuffer(const std::vector<Vertex>& vertices) {
+        template <typename VertexType>
+        static GLuint CreateVertexBuffer(const std::vector<VertexType>& vertices) {
             GLuint vbo;
 
             //Generates the Buffer Object for the VBO
@@ -224,7 +3215,7 @@ namespace IMPT {
             glBindBuffer(GL_ARRAY_BUFFER, vbo);
 
             //Fills the VBO with the Vertices Data
-            glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), &vertices[0], GL_STATIC_DRAW);
+            glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(VertexType), vertices.data(), GL_STATIC_DRAW);
 
             //Unbinds the VBO
             glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -234,44 +3225,230 @@ namespace IMPT {
         }
 
         /**
-         * @brief BindVertexBuffer - Binds a Vertex Buffer Obejct (VBO) and Sets Up the Vertices Attribute Pointers
+         * @brief CreateBuffer - Creates a Buffer Object and Fills it with Bytes as they are
+         *
+         * @param Target : The Buffer Target, such as GL_ARRAY_BUFFER
+         * @param Data : The Bytes to Store
+         * @param Size : The Number of Bytes
+         * @return : The Generated Buffer
+         */
+        static GLuint CreateBuffer(GLenum target, const void* data, size_t size) {
+            GLuint buffer;
+            glGenBuffers(1, &buffer);
+            glBindBuffer(target, buffer);
+            glBufferData(target, static_cast<GLsizeiptr>(size), data, GL_STATIC_DRAW);
+            glBindBuffer(target, 0);
+            return buffer;
+        }
+
+        /**
+         * @brief CreateIndexBuffer - Creates an Index Buffer Obejct (IBO) and Filles it with the Given Triangle Indices
+         *
+         * @param Indices : The Vector of Indices to be Stored in the IBO
+         * @return : The Generated IBO
+         */
+        static GLuint CreateIndexBuffer(const std::vector<GLuint>& indices) {
+            GLuint ibo;
+
+            //Generates the Buffer Object for the IBO
+            glGenBuffers(1, &ibo);
+
+            //Bind the IBO as an Element Array Buffer
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+
+            //Fills the IBO with the Indices Data
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+
+            //Unbinds the IBO
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+            //Retruns the Generated IBO ID
+            return ibo;
+        }
+
+        /**
+         * @brief PackVertices - Converts Vertices to the Packed Vertex Format
+         *
+         * Positions are Quantized with One Scale for all Axes, so the Dequantization is a Uniform Scale
+         * and Normals Keep their Direction when Transformed.
+         *
+         * @param Vertices : The Vertices to Pack
+         * @param Layout : Receives the Layout and Dequantization Transform of the Packed Vertices
+         * @return : The Packed Vertices
+         */
+        static std::vector<PackedVertex> PackVertices(const std::vector<Vertex>& vertices, VertexLayout& layout) {
+            glm::vec3 boundsMin(0.0f), boundsMax(0.0f);
+            if (!vertices.empty()) {
+                boundsMin = boundsMax = vertices[0].position;
+                for (const Vertex& vertex : vertices) {
+                    boundsMin = glm::min(boundsMin, vertex.position);
+                    boundsMax = glm::max(boundsMax, vertex.position);
+                }
+            }
+
+            glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+            glm::vec3 halfExtent = (boundsMax - boundsMin) * 0.5f;
+            float largestHalfExtent = std::max(std::max(halfExtent.x, halfExtent.y), std::max(halfExtent.z, 1e-20f));
+
+            layout.stride = sizeof(PackedVertex);
+            layout.position = { 3, GL_SHORT, offsetof(PackedVertex, position) };
+            layout.normal = { 3, GL_INT_2_10_10_10_REV, offsetof(PackedVertex, normal) };
+            layout.texcoord = { 2, GL_HALF_FLOAT, offsetof(PackedVertex, texcoord) };
+            layout.positionOffset = center;
+            layout.positionScale = largestHalfExtent / 32767.0f;
+
+            std::vector<PackedVertex> packedVertices(vertices.size());
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                const Vertex& vertex = vertices[i];
+                PackedVertex& packed = packedVertices[i];
+
+                glm::vec3 quantized = glm::round((vertex.position - center) / largestHalfExtent * 32767.0f);
+                packed.position[0] = static_cast<int16_t>(glm::clamp(quantized.x, -32767.0f, 32767.0f));
+                packed.position[1] = static_cast<int16_t>(glm::clamp(quantized.y, -32767.0f, 32767.0f));
+                packed.position[2] = static_cast<int16_t>(glm::clamp(quantized.z, -32767.0f, 32767.0f));
+                packed.position[3] = 0;
+                packed.normal = glm::packSnorm3x10_1x2(glm::vec4(vertex.normal, 0.0f));
+                packed.texcoord[0] = glm::packHalf1x16(vertex.texcoord.x);
+                packed.texcoord[1] = glm::packHalf1x16(vertex.texcoord.y);
+            }
+            return packedVertices;
+        }
+
+        /**
+         * @brief IsVertexFormatSupported - Checks if the Current GL Context can Read a Vertex Format
+         *
+         * @param Format : The Vertex Format
+         * @return : True if the Attribute Types of the Format are Supported
+         */
+        static bool IsVertexFormatSupported(VertexFormat format) {
+            if (format == VertexFormat::Packed)
+                return GLEW_VERSION_3_3 || (GLEW_ARB_vertex_type_2_10_10_10_rev && GLEW_ARB_half_float_vertex);
+            return true;
+        }
+
+        /**
+         * @brief BindVertexBuffer - Binds a Vertex Buffer Obejct (VBO) of Float Vertices and Sets Up the Vertices Attribute Pointers
          *
          * @param VBO : The ID of the VBO to Bind
          * @return : Void
          */
         static void BindVertexArray(const GLuint vbo) {
+            BindVertexArray(vbo, VertexLayout());
+        }
+
+        /**
+         * @brief BindVertexBuffer - Binds a Vertex Buffer Obejct (VBO) and Sets Up the Vertices Attribute Pointers
+         *
+         * @param VBO : The ID of the VBO to Bind
+         * @param Layout : The Layout of the Vertices in the VBO
+         * @return : Void
+         */
+        static void BindVertexArray(const GLuint vbo, const VertexLayout& layout) {
 
             //Binds the VBO as an Array Buffer
             glBindBuffer(GL_ARRAY_BUFFER, vbo);
 
             //Enables and Sets Up the Vertex Pointers, the Normal Pointers and the Texture Coordinate Pointers
             glEnableClientState(GL_VERTEX_ARRAY);
-            glVertexPointer(3, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const GLvoid*>(offsetof(Vertex, position)));
+            glVertexPointer(layout.position.size, layout.position.type, AttributeStride(layout, layout.position), reinterpret_cast<const GLvoid*>(layout.position.offset));
             glEnableClientState(GL_NORMAL_ARRAY);
-            glNormalPointer(GL_FLOAT, sizeof(Vertex), reinterpret_cast<const GLvoid*>(offsetof(Vertex, normal)));
+            glNormalPointer(layout.normal.type, AttributeStride(layout, layout.normal), reinterpret_cast<const GLvoid*>(layout.normal.offset));
             glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-            glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex), reinterpret_cast<const GLvoid*>(offsetof(Vertex, texcoord)));
+            glTexCoordPointer(layout.texcoord.size, layout.texcoord.type, AttributeStride(layout, layout.texcoord), reinterpret_cast<const GLvoid*>(layout.texcoord.offset));
         }
 
         /**
-         * @brief Send - Creates a Vertex Buffer Obejct (VBO) and Binds it, then sets up Vertex attribute pointers
+         * @brief AttributeStride - The Distance between Consecutive Values of an Attribute
          *
-         * @param Vertices : The Vector of Vertices to be Stored in the VBO
-         * @return : The Generated VBO
+         * @param Layout : The Layout of the Vertices
+         * @param Attribute : The Attribute
+         * @return : The Stride in Bytes
+         */
+        static GLsizei AttributeStride(const VertexLayout& layout, const VertexAttribute& attribute) {
+            return attribute.stride != 0 ? attribute.stride : layout.stride;
+        }
+
+        /**
+         * @brief Send - Creates the Vertex and Index Buffers of each Object and Binds them, then sets up Vertex attribute pointers
+         *
+         * Objects that Share a Mesh also Share its Buffers, so each Distinct Mesh is Uploaded Once.
+         * Meshes Mapped from glTF Files Keep the Layout of the File, whatever the Format.
+         *
+         * @param ObjectDataList : The List of Objects whose Meshes will be Stored in the Buffers
+         * @param Format : How the Vertices are Stored in the VBOs, Falls Back to Float if the Context can't Read it
+         * @return : The Generated Buffers of each Object
          */
-        static std::vector<GLuint> Send(std::vector<std::pair<std::vector<Vertex>, Material>>& ObjectDataList)
+        static std::vector<MeshBuffers> Send(std::vector<ObjectData>& ObjectDataList, VertexFormat format = VertexFormat::Float)
         {
-            std::vector<GLuint> vboIDs;
+            std::vector<MeshBuffers> meshBuffersList;
+
+            if (!IsVertexFormatSupported(format)) {
+                std::cerr << "Packed vertex format not supported, using float vertices" << std::endl;
+                format = VertexFormat::Float;
+            }
+            std::unordered_map<const Mesh*, MeshBuffers> uploadedMeshes;
 
-            //Create and Bind the Vertex Buffer Object for each Object in ObjectDataList
+            //Create and Bind the Vertex and Index Buffer Objects for each Distinct Mesh in ObjectDataList
             for (auto& ObjectData : ObjectDataList) {
-                GLuint vbo = CreateVertexBuffer(ObjectData.first);
-                BindVertexArray(vbo);
-                vboIDs.push_back(vbo);
+                const Mesh& mesh = *ObjectData.first;
+                auto uploaded = uploadedMeshes.find(&mesh);
+                if (uploaded != uploadedMeshes.end()) {
+                    meshBuffersList.push_back(uploaded->second);
+                    continue;
+                }
+
+                MeshBuffers meshBuffers;
+                size_t indexCount = mesh.indices.size();
+                if (mesh.mapped) {
+                    //Mapped glTF Data Goes from the File to the Driver as it is, in the Layout it was Stored with
+                    meshBuffers.vbo = CreateBuffer(GL_ARRAY_BUFFER, mesh.mapped->vertexData, mesh.mapped->vertexSize);
+                    meshBuffers.layout = mesh.mapped->layout;
+                }
+                else if (format == VertexFormat::Packed) {
+                    meshBuffers.vbo = CreateVertexBuffer(PackVertices(mesh.vertices, meshBuffers.layout));
+                }
+                else {
+                    meshBuffers.vbo = CreateVertexBuffer(mesh.vertices);
+                }
+
+                if (mesh.mapped && mesh.mapped->indexData) {
+                    meshBuffers.ibo = CreateBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.mapped->indexData, mesh.mapped->indexCount * sizeof(GLuint));
+                    indexCount = mesh.mapped->indexCount;
+                }
+                else {
+                    meshBuffers.ibo = CreateIndexBuffer(mesh.indices);
+                }
+
+                meshBuffers.lods = mesh.lods;
+                meshBuffers.meshlets = mesh.meshlets;
+                meshBuffers.submeshes = mesh.submeshes;
+                if (meshBuffers.lods.empty())
+                    meshBuffers.lods.push_back({ 0, static_cast<GLuint>(indexCount), 0.0f });
+                meshBuffers.indexCount = static_cast<GLsizei>(meshBuffers.lods[0].indexCount);
+                BindVertexArray(meshBuffers.vbo, meshBuffers.layout);
+                uploadedMeshes.emplace(&mesh, meshBuffers);
+                meshBuffersList.push_back(meshBuffers);
             }
 
-            //Retruns a List of the Generated VBO ID
-            return vboIDs;
+            //Retruns a List of the Generated Buffers
+            return meshBuffersList;
+        }
+
+        /**
+         * @brief DeleteBuffers - Deletes the Vertex and Index Buffers Created by Send, Shared Buffers are Deleted Once
+         *
+         * @param MeshBuffersList : The Buffers to Delete
+         * @return : Void
+         */
+        static void DeleteBuffers(const std::vector<MeshBuffers>& meshBuffersList) {
+            std::vector<GLuint> buffers;
+            for (const MeshBuffers& meshBuffers : meshBuffersList) {
+                buffers.push_back(meshBuffers.vbo);
+                buffers.push_back(meshBuffers.ibo);
+            }
+            std::sort(buffers.begin(), buffers.end());
+            buffers.erase(std::unique(buffers.begin(), buffers.end()), buffers.end());
+            glDeleteBuffers(static_cast<GLsizei>(buffers.size()), buffers.data());
         }
 
         /**
@@ -393,30 +3570,12 @@ namespace IMPT {
         }
 
         /**
-         * @brief Draw - Draws an Object
+         * @brief BindMaterial - Sets the Texture and Fixed Function Material State of a Material
          *
-         * @param Position : The Position of the Object
-         * @param Orientation : The Orie ntationof the Object
-         * @param ObjectData : The List Containing the Object Data (Vertex and Material)
-         * @param VBO : The ID of the Vertex Buffer Object (VBO)
-         * @param ShaderProgram : The Id of the Shader Program
+         * @param Material : The Material
          * @return : Void
          */
-        static void Draw(const glm::vec3& position, const glm::vec3& orientation, const std::pair<std::vector<Vertex>, Material>& objData, GLuint vbo/*, GLuint shaderProgram*/) {
-
-            const std::vector<Vertex>& vertices = objData.first;
-            const Material& material = objData.second;
-
-            //Bind the Existing VBO to Render
-            BindVertexArray(vbo);
-
-            //Set the Position and Orientation of the Object
-            glPushMatrix();
-            glTranslatef(position.x, position.y, position.z);
-            glRotatef(orientation.x, 1.0f, 0.0f, 0.0f);
-            glRotatef(orientation.y, 0.0f, 1.0f, 0.0f);
-            glRotatef(orientation.z, 0.0f, 0.0f, 1.0f);
-
+        static void BindMaterial(const Material& material) {
             //Bind the Texture to the Object
             glBindTexture(GL_TEXTURE_2D, material.textureID);
 
@@ -433,17 +3592,102 @@ namespace IMPT {
             glMaterialfv(GL_FRONT, GL_DIFFUSE, glm::value_ptr(glm::vec4(material.diffuse, 1.0f)));
             glMaterialfv(GL_FRONT, GL_SPECULAR, glm::value_ptr(glm::vec4(material.specular, 1.0f)));
             glMaterialf(GL_FRONT, GL_SHININESS, material.shininess);
+        }
+
+        /**
+         * @brief Draw - Draws an Object
+         *
+         * The Indices of a Level of Detail are Sorted by Material, so each Material is Set Once and its Triangles
+         * are Drawn with a Single Range Draw, however many Groups the File Split them into. A Submesh Split into
+         * Meshlets is Culled Cluster by Cluster on the CPU, so only Clusters that may be Seen are Submitted.
+         *
+         * @param Position : The Position of the Object
+         * @param Orientation : The Orie ntationof the Object
+         * @param ObjectData : The List Containing the Object Data (Mesh and Materials)
+         * @param MeshBuffers : The Vertex and Index Buffers of the Object
+         * @param LodLevel : The Level of Detail the Object Used Last Frame, Updated for this Frame (Null Draws Full Detail)
+         * @param ShaderProgram : The Id of the Shader Program
+         * @return : Void
+         */
+        static void Draw(const glm::vec3& position, const glm::vec3& orientation, const ObjectData& objData, const MeshBuffers& meshBuffers, size_t* lodLevel = nullptr/*, GLuint shaderProgram*/) {
 
+            const std::vector<Material>& materials = objData.second;
 
-            //Render the Object using the Vertex Array Object (VBO)
-            glDrawArrays(GL_TRIANGLES, 0, vertices.size());
+            //Bind the Existing VBO and IBO to Render
+            BindVertexArray(meshBuffers.vbo, meshBuffers.layout);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshBuffers.ibo);
+
+            //Set the Position and Orientation of the Object
+            glPushMatrix();
+            glTranslatef(position.x, position.y, position.z);
+            glRotatef(orientation.x, 1.0f, 0.0f, 0.0f);
+            glRotatef(orientation.y, 0.0f, 1.0f, 0.0f);
+            glRotatef(orientation.z, 0.0f, 0.0f, 1.0f);
+
+            //Picks the Level of Detail from how Large the Object is on Screen
+            Lod lod = { 0, static_cast<GLuint>(meshBuffers.indexCount), 0.0f };
+            if (lodLevel && !meshBuffers.lods.empty()) {
+                *lodLevel = SelectLod(meshBuffers.lods, PixelsPerUnit(), *lodLevel);
+                lod = meshBuffers.lods[*lodLevel];
+            }
+            else if (!meshBuffers.lods.empty()) {
+                lod = meshBuffers.lods[0];
+            }
+
+            //The Submeshes of the Level, a Level without any is Drawn Whole with the First Material
+            Submesh whole = { 0, lod.indexOffset, lod.indexCount, lod.meshletOffset, lod.meshletCount };
+            const Submesh* submeshes = lod.submeshCount > 0 ? meshBuffers.submeshes.data() + lod.submeshOffset : &whole;
+            size_t submeshCount = lod.submeshCount > 0 ? lod.submeshCount : 1;
+
+            //The Clusters are Culled Before the Quantization Transform, since the Cluster Bounds are in Mesh Space.
+            //The Frustum is Derived Once for all Submeshes
+            std::optional<MeshletCuller> culler;
+            if (lod.meshletCount > 0) {
+                glm::mat4 modelView, projection;
+                glGetFloatv(GL_MODELVIEW_MATRIX, glm::value_ptr(modelView));
+                glGetFloatv(GL_PROJECTION_MATRIX, glm::value_ptr(projection));
+                culler.emplace(modelView, projection);
+            }
+
+            //Maps Quantized Positions back to the Mesh Positions, the Scale is Uniform so Normals Only Need Renormalizing
+            const VertexLayout& layout = meshBuffers.layout;
+            bool quantized = layout.position.type != GL_FLOAT;
+            if (quantized) {
+                glTranslatef(layout.positionOffset.x, layout.positionOffset.y, layout.positionOffset.z);
+                glScalef(layout.positionScale, layout.positionScale, layout.positionScale);
+                glEnable(GL_NORMALIZE);
+            }
+
+            //Render each Material using the Index Buffer Object (IBO), so Shared Vertices are Transformed Once. The
+            //Visible Ranges Reuse the Buffers of the Previous Draws on this Thread, so a Frame doesn't Allocate
+            static thread_local std::vector<GLsizei> rangeCounts;
+            static thread_local std::vector<const GLvoid*> rangeOffsets;
+            for (size_t s = 0; s < submeshCount; ++s) {
+                const Submesh& submesh = submeshes[s];
+
+                //Drops the Clusters that Face Away from the Camera or Lie Outside the View
+                bool clustered = submesh.meshletCount > 0 && culler;
+                if (clustered && CullMeshlets(meshBuffers.meshlets, submesh, *culler, rangeCounts, rangeOffsets) == 0)
+                    continue;
+
+                if (submesh.material < materials.size())
+                    BindMaterial(materials[submesh.material]);
+
+                if (clustered)
+                    glMultiDrawElements(GL_TRIANGLES, rangeCounts.data(), GL_UNSIGNED_INT, rangeOffsets.data(), static_cast<GLsizei>(rangeCounts.size()));
+                else
+                    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(submesh.indexCount), GL_UNSIGNED_INT, reinterpret_cast<const GLvoid*>(submesh.indexOffset * sizeof(GLuint)));
+            }
 
             //Cleanup
             glBindTexture(GL_TEXTURE_2D, 0);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             glBindBuffer(GL_ARRAY_BUFFER, 0);
             glDisableClientState(GL_TEXTURE_COORD_ARRAY);
             glDisableClientState(GL_NORMAL_ARRAY);
             glDisableClientState(GL_VERTEX_ARRAY);
+            if (quantized)
+                glDisable(GL_NORMALIZE);
             glPopMatrix();
         }
 
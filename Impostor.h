@@ -0,0 +1,219 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include "Importer.h"
+
+namespace IMPT {
+
+    /**
+     * @brief SphereImpostor - Draws Spherical Objects as Camera Facing Quads that are Ray Cast per Pixel
+     *
+     * The Fragment Shader Intersects each Pixel's Ray with the Analytic Sphere, Writes the Depth of the
+     * Hit and Derives the Normal and the Spherical Texture Coordinates from it, so a Ball Costs 4 Vertices
+     * instead of its Whole Mesh. Lighting Reads the Fixed Function Light and Material State, so it is a
+     * Drop-in Alternative to ObjectLoader::Draw.
+     */
+    class SphereImpostor {
+    public:
+
+        SphereImpostor() = default;
+        SphereImpostor(const SphereImpostor&) = delete;
+        SphereImpostor& operator=(const SphereImpostor&) = delete;
+
+        /**
+         * @brief Create - Compiles the Impostor Shaders and Creates the Quad they Expand
+         *
+         * @param VertexShaderPath : The Path of the Impostor Vertex Shader
+         * @param FragmentShaderPath : The Path of the Impostor Fragment Shader
+         * @return : True if the Impostor can be Drawn, Otherwise Objects should be Drawn as Meshes
+         */
+        bool Create(const std::string& vertexShaderPath, const std::string& fragmentShaderPath) {
+            Delete();
+
+            std::string vertexShaderCode = ObjectLoader::readShaderFile(vertexShaderPath);
+            std::string fragmentShaderCode = ObjectLoader::readShaderFile(fragmentShaderPath);
+            if (vertexShaderCode.empty() || fragmentShaderCode.empty())
+                return false;
+
+            program = ObjectLoader::createShaderProgram(vertexShaderCode, fragmentShaderCode);
+            if (program == 0) {
+                std::cerr << "Sphere impostors are unavailable, balls will be drawn as meshes" << std::endl;
+                return false;
+            }
+
+            //Looks Up the Inputs Once, instead of Every Draw
+            cornerLocation = glGetAttribLocation(program, "corner");
+            sphereCenterLocation = glGetUniformLocation(program, "sphereCenter");
+            sphereRadiusLocation = glGetUniformLocation(program, "sphereRadius");
+            textureUOffsetLocation = glGetUniformLocation(program, "textureUOffset");
+            textureSamplerLocation = glGetUniformLocation(program, "textureSampler");
+            lightEnabledLocation = glGetUniformLocation(program, "lightEnabled");
+
+            //Corners of the Quad, Drawn as a Triangle Strip
+            const GLfloat corners[] = { -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, 1.0f };
+            glGenBuffers(1, &quadVBO);
+            glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+            return true;
+        }
+
+        /**
+         * @brief IsReady - Checks if the Impostor was Created Successfully
+         *
+         * @return : True if Draw can be Used
+         */
+        bool IsReady() const {
+            return program != 0 && quadVBO != 0 && cornerLocation >= 0;
+        }
+
+        /**
+         * @brief Delete - Deletes the Shader Program and the Quad, Must be Called while the GL Context Exists
+         *
+         * @return : Void
+         */
+        void Delete() {
+            if (program != 0)
+                glDeleteProgram(program);
+            if (quadVBO != 0)
+                glDeleteBuffers(1, &quadVBO);
+            program = 0;
+            quadVBO = 0;
+            cornerLocation = -1;
+            shapes.clear();
+        }
+
+        /**
+         * @brief Draw - Draws a Spherical Object as a Ray Cast Quad
+         *
+         * @param Position : The Position of the Object
+         * @param Orientation : The Orientation of the Object
+         * @param ObjectData : The Object Data (Mesh and Materials), the Mesh is Only Read to Fit the Sphere and it is Shaded with the First Material
+         * @return : Void
+         */
+        void Draw(const glm::vec3& position, const glm::vec3& orientation, const ObjectLoader::ObjectData& objData) {
+
+            const ObjectLoader::Material& material = objData.second.front();
+            const Shape& shape = FitShape(*objData.first);
+
+            //Set the Position and Orientation of the Object, the same way as ObjectLoader::Draw
+            glPushMatrix();
+            glTranslatef(position.x, position.y, position.z);
+            glRotatef(orientation.x, 1.0f, 0.0f, 0.0f);
+            glRotatef(orientation.y, 0.0f, 1.0f, 0.0f);
+            glRotatef(orientation.z, 0.0f, 0.0f, 1.0f);
+
+            //The Shader Reads the Material from the Fixed Function State
+            glMaterialfv(GL_FRONT, GL_AMBIENT, glm::value_ptr(glm::vec4(material.ambient, 1.0f)));
+            glMaterialfv(GL_FRONT, GL_DIFFUSE, glm::value_ptr(glm::vec4(material.diffuse, 1.0f)));
+            glMaterialfv(GL_FRONT, GL_SPECULAR, glm::value_ptr(glm::vec4(material.specular, 1.0f)));
+            glMaterialf(GL_FRONT, GL_SHININESS, material.shininess);
+
+            glUseProgram(program);
+
+            //Lights Toggled with glEnable are Invisible to Shaders
+            GLint lightEnabled[4];
+            for (int i = 0; i < 4; ++i)
+                lightEnabled[i] = glIsEnabled(GL_LIGHT0 + i) ? 1 : 0;
+            glUniform1iv(lightEnabledLocation, 4, lightEnabled);
+
+            glUniform3fv(sphereCenterLocation, 1, glm::value_ptr(shape.center));
+            glUniform1f(sphereRadiusLocation, shape.radius);
+            glUniform1f(textureUOffsetLocation, shape.textureUOffset);
+
+            //Bind the Texture to the Object
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, material.textureID);
+            glUniform1i(textureSamplerLocation, 0);
+
+            //Render the Quad
+            glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+            glEnableVertexAttribArray(static_cast<GLuint>(cornerLocation));
+            glVertexAttribPointer(static_cast<GLuint>(cornerLocation), 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+            glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+            //Cleanup
+            glDisableVertexAttribArray(static_cast<GLuint>(cornerLocation));
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            glUseProgram(0);
+            glPopMatrix();
+        }
+
+    private:
+
+        //The Analytic Sphere that Stands in for a Mesh
+        struct Shape {
+            glm::vec3 center;
+            float radius;
+            float textureUOffset;
+        };
+
+        /**
+         * @brief FitShape - Fits a Sphere to a Mesh, Once per Shared Mesh
+         *
+         * @param Mesh : The Mesh to Fit
+         * @return : The Sphere and the Longitude of its Texture Seam
+         */
+        const Shape& FitShape(const ObjectLoader::Mesh& mesh) {
+            auto found = shapes.find(&mesh);
+            if (found != shapes.end())
+                return found->second;
+
+            //Meshes Left in a glTF File are Read Back for the Fit
+            std::vector<ObjectLoader::Vertex> mappedVertices;
+            if (mesh.mapped)
+                mappedVertices = ObjectLoader::ReadMappedVertices(*mesh.mapped);
+            const std::vector<ObjectLoader::Vertex>& vertices = mesh.mapped ? mappedVertices : mesh.vertices;
+
+            //The Center of the Bounding Box, and the Farthest Vertex from it
+            glm::vec3 minimum(FLT_MAX), maximum(-FLT_MAX);
+            for (const ObjectLoader::Vertex& vertex : vertices) {
+                minimum = glm::min(minimum, vertex.position);
+                maximum = glm::max(maximum, vertex.position);
+            }
+
+            Shape shape = { glm::vec3(0.0f), 0.0f, 0.0f };
+            if (!vertices.empty())
+                shape.center = (minimum + maximum) * 0.5f;
+            for (const ObjectLoader::Vertex& vertex : vertices)
+                shape.radius = std::max(shape.radius, glm::distance(vertex.position, shape.center));
+
+            //Recovers where u = 0 Lies from the Vertex Closest to the Equator, where Longitude is Well Defined
+            const float TWO_PI = 6.28318530717958647692f;
+            float bestLatitude = FLT_MAX;
+            for (const ObjectLoader::Vertex& vertex : vertices) {
+                glm::vec3 direction = vertex.position - shape.center;
+                float latitude = std::fabs(direction.y) / std::max(glm::length(direction), FLT_MIN);
+                if (latitude < bestLatitude) {
+                    bestLatitude = latitude;
+                    float offset = vertex.texcoord.x + std::atan2(direction.z, direction.x) / TWO_PI;
+                    shape.textureUOffset = offset - std::floor(offset);
+                }
+            }
+
+            return shapes.emplace(&mesh, shape).first->second;
+        }
+
+        GLuint program = 0;
+        GLuint quadVBO = 0;
+        GLint cornerLocation = -1;
+        GLint sphereCenterLocation = -1;
+        GLint sphereRadiusLocation = -1;
+        GLint textureUOffsetLocation = -1;
+        GLint textureSamplerLocation = -1;
+        GLint lightEnabledLocation = -1;
+
+        //Fitted Spheres, Keyed by the Shared Mesh so Identical Balls are Fitted Once
+        std::unordered_map<const ObjectLoader::Mesh*, Shape> shapes;
+    };
+}
@@ -0,0 +1,106 @@
+#version 130
+
+in vec3 viewPosition;
+in vec3 viewCenter;
+in float viewRadius;
+
+out vec4 fragColorOut;
+
+uniform sampler2D textureSampler;
+
+//Longitude of the Texture's u = 0 Column, as a Fraction of a Turn
+uniform float textureUOffset;
+
+//Which of the Fixed Function Lights are Enabled
+uniform bool lightEnabled[4];
+
+const float PI = 3.14159265358979;
+
+/**
+ * @brief Light - Evaluates one Fixed Function Light, the same way glLight does
+ */
+vec4 Light(int i, vec3 position, vec3 normal, vec3 eye)
+{
+    vec3 lightDirection;
+    float attenuation = 1.0;
+
+    if (gl_LightSource[i].position.w == 0.0) {
+        //Directional Light
+        lightDirection = normalize(gl_LightSource[i].position.xyz);
+    }
+    else {
+        //Point and Spot Lights
+        vec3 toLight = gl_LightSource[i].position.xyz / gl_LightSource[i].position.w - position;
+        float distance = length(toLight);
+        lightDirection = toLight / distance;
+        attenuation = 1.0 / (gl_LightSource[i].constantAttenuation + gl_LightSource[i].linearAttenuation * distance + gl_LightSource[i].quadraticAttenuation * distance * distance);
+
+        if (gl_LightSource[i].spotCutoff != 180.0) {
+            float spotDot = dot(-lightDirection, normalize(gl_LightSource[i].spotDirection));
+            attenuation *= spotDot < gl_LightSource[i].spotCosCutoff ? 0.0 : pow(max(spotDot, 0.0), gl_LightSource[i].spotExponent);
+        }
+    }
+
+    float diffuseFactor = max(dot(normal, lightDirection), 0.0);
+    float specularFactor = 0.0;
+    if (diffuseFactor > 0.0)
+        specularFactor = pow(max(dot(normal, normalize(lightDirection + eye)), 0.0), gl_FrontMaterial.shininess);
+
+    return attenuation * (gl_FrontLightProduct[i].ambient + diffuseFactor * gl_FrontLightProduct[i].diffuse + specularFactor * gl_FrontLightProduct[i].specular);
+}
+
+void main()
+{
+    //Casts the Ray of this Pixel, Parallel to the View Axis for Orthographic Projections
+    vec3 origin, direction;
+    if (gl_ProjectionMatrix[3][3] == 1.0) {
+        origin = viewPosition;
+        direction = vec3(0.0, 0.0, -1.0);
+    }
+    else {
+        origin = vec3(0.0);
+        direction = normalize(viewPosition);
+    }
+
+    //Intersects the Ray with the Sphere, Pixels that Miss it are Outside the Silhouette
+    vec3 offset = origin - viewCenter;
+    float b = dot(offset, direction);
+    float c = dot(offset, offset) - viewRadius * viewRadius;
+    float discriminant = b * b - c;
+    if (discriminant < 0.0)
+        discard;
+
+    vec3 hit = origin + direction * (-b - sqrt(discriminant));
+    vec3 normal = (hit - viewCenter) / viewRadius;
+
+    //Writes the Depth of the Sphere Surface, not of the Quad
+    vec4 clip = gl_ProjectionMatrix * vec4(hit, 1.0);
+    gl_FragDepth = (gl_DepthRange.diff * (clip.z / clip.w) + gl_DepthRange.near + gl_DepthRange.far) * 0.5;
+
+    //Spherical Texture Coordinates from the Normal in Object Space
+    vec3 objectNormal = normalize(transpose(mat3(gl_ModelViewMatrix)) * normal);
+    float longitude = atan(objectNormal.z, objectNormal.x) / (2.0 * PI);
+    vec2 texcoord = vec2(fract(textureUOffset - longitude), asin(clamp(objectNormal.y, -1.0, 1.0)) / PI + 0.5);
+
+    //The u Wrap would make the Derivatives Jump, so they are Taken from whichever Parameterization is Continuous Here
+    float seamlessU = fract(textureUOffset - longitude + 0.5) - 0.5;
+    vec2 gradientX = vec2(dFdx(texcoord.x), dFdx(texcoord.y));
+    vec2 gradientY = vec2(dFdy(texcoord.x), dFdy(texcoord.y));
+    if (abs(dFdx(seamlessU)) + abs(dFdy(seamlessU)) < abs(gradientX.x) + abs(gradientY.x)) {
+        gradientX.x = dFdx(seamlessU);
+        gradientY.x = dFdy(seamlessU);
+    }
+
+    //Lights the Surface the way the Fixed Function Pipeline Does, then Modulates it with the Texture
+    //Infinite Viewer, the Fixed Function Default
+    vec3 eye = vec3(0.0, 0.0, 1.0);
+    vec4 color = gl_FrontLightModelProduct.sceneColor;
+    for (int i = 0; i < 4; ++i) {
+        if (lightEnabled[i])
+            color += Light(i, hit, normal, eye);
+    }
+    color = clamp(color, 0.0, 1.0);
+    color.a = gl_FrontMaterial.diffuse.a;
+
+    fragColorOut = color * textureGrad(textureSampler, texcoord, gradientX, gradientY);
+}
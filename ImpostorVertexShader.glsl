@@ -0,0 +1,26 @@
+#version 130
+
+//Unit Quad Corner, from (-1, -1) to (1, 1)
+in vec2 corner;
+
+uniform vec3 sphereCenter;
+uniform float sphereRadius;
+
+out vec3 viewPosition;
+out vec3 viewCenter;
+out float viewRadius;
+
+void main()
+{
+    //Sphere in View Space, the Modelview Matrix has a Uniform Scale
+    viewCenter = (gl_ModelViewMatrix * vec4(sphereCenter, 1.0)).xyz;
+    viewRadius = sphereRadius * length(gl_ModelViewMatrix[0].xyz);
+
+    //Perspective Silhouettes can Extend Past the Radius Away from the View Axis
+    bool orthographic = gl_ProjectionMatrix[3][3] == 1.0;
+    float grow = orthographic ? 1.0 : 1.5;
+
+    //The Quad Faces the Camera and Touches the Front of the Sphere, so Rays Start Outside it
+    viewPosition = viewCenter + vec3(corner * viewRadius * grow, viewRadius);
+    gl_Position = gl_ProjectionMatrix * vec4(viewPosition, 1.0);
+}
@@ -18,6 +18,8 @@ bool directionalLightEnable = true;
 bool pointLightEnable = true;
 bool spotLightEnable = true;
 
+bool impostorEnable = false;
+
 /**
  * @brief CursorPositionCallback - Checks were the mouse is compared to before, and if it changes, Rotates the View
  *
@@ -130,6 +132,10 @@ void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods
 			//If the Key Pressed is Four, The Light is Changed to Spot Light
             spotLightEnable = !spotLightEnable;
             break;
+        case GLFW_KEY_I:
+			//If the Key Pressed is I, the Balls are Switched between Meshes and Ray Cast Impostors
+            impostorEnable = !impostorEnable;
+            break;
         }
     }
 }
@@ -11,6 +11,7 @@ extern bool ambientLightEnable;
 extern bool directionalLightEnable;
 extern bool pointLightEnable;
 extern bool spotLightEnable;
+extern bool impostorEnable;
 
 //Functions Used in Iput.cpp
 void cursorPositionCallback(GLFWwindow* window, double xPos, double yPos);
@@ -0,0 +1,260 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "Parallel.h"
+#include "stb_image.h"
+
+namespace IMPT {
+
+    /**
+     * @brief JpegDecoder - Decodes a Single Large JPEG across Threads, Bit Identical to stb_image
+     *
+     * A Baseline JPEG with Restart Markers Resets its Entropy Decoder at every Marker, so the Scan can be Cut
+     * at the Restart Intervals that Start a Row of MCUs. Each Band of Rows is Decoded by stb_image as a JPEG of
+     * its own, made of the Original Headers with a Smaller Height and the Slice of the Scan, plus one Band of
+     * Margin above and below so the Chroma Upsampling Sees the Same Neighbours as a Whole Decode. The Margins
+     * are Dropped when the Bands are Stitched Together.
+     *
+     * Anything else (Progressive or Arithmetic Coding, Several Scans, no Restart Markers, Small Images) is
+     * Decoded in one Piece by stb_image.
+     */
+    class JpegDecoder {
+    public:
+
+        //Images with Fewer Pixels are not Worth Splitting
+        static constexpr size_t MIN_PARALLEL_PIXELS = 1 << 21;
+
+        //Fewest Rows of Pixels Decoded per Band, so the Margins Stay Small Next to the Band
+        static constexpr size_t MIN_BAND_ROWS = 128;
+
+        /**
+         * @brief Decode - Decodes an Image File in Memory, Splitting Baseline JPEGs with Restart Markers across Threads
+         *
+         * Same Contract as stbi_load_from_memory, the Pixels are Freed with stbi_image_free. Called from a Task of a
+         * TaskPool, the Bands Run on the Idle Workers of that Pool instead of on Threads Started for the Call.
+         *
+         * @param Data : The Bytes of the Image File
+         * @param Size : The Number of Bytes
+         * @param Width : Receives the Width of the Image
+         * @param Height : Receives the Height of the Image
+         * @param Channels : Receives the Number of Channels in the File
+         * @param RequestedChannels : The Number of Channels of the Pixels, 0 Keeps the Channels of the File
+         * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count)
+         * @return : The Pixels, Null if the Decoding Failed
+         */
+        static unsigned char* Decode(const unsigned char* data, size_t size, int* width, int* height, int* channels,
+            int requestedChannels, size_t threadCount = 0) {
+            if (size > INT_MAX)
+                return nullptr;
+            if (threadCount == 0)
+                threadCount = DefaultThreadCount();
+
+            Layout layout;
+            if (threadCount < 2 || !ReadLayout(data, size, layout))
+                return stbi_load_from_memory(data, static_cast<int>(size), width, height, channels, requestedChannels);
+
+            //Bands are Cut at Units, the Fewest MCU Rows that Start with a Restart Interval
+            size_t unitRows = layout.unitMcuRows * layout.mcuHeight;
+            size_t unitCount = (layout.mcuRows + layout.unitMcuRows - 1) / layout.unitMcuRows;
+            size_t bandCount = std::min(threadCount, layout.height / std::max(MIN_BAND_ROWS, unitRows));
+            bandCount = std::min(bandCount, unitCount);
+            if (bandCount < 2 || layout.width * layout.height < MIN_PARALLEL_PIXELS)
+                return stbi_load_from_memory(data, static_cast<int>(size), width, height, channels, requestedChannels);
+
+            struct Band {
+                size_t firstRow = 0;
+                size_t rowCount = 0;
+                size_t skippedRows = 0;
+                unsigned char* pixels = nullptr;
+                int width = 0;
+                int height = 0;
+                int channels = 0;
+            };
+            std::vector<Band> bands(bandCount);
+
+            ParallelFor(bandCount, threadCount, [&](size_t b) {
+                size_t firstUnit = unitCount * b / bandCount;
+                size_t endUnit = unitCount * (b + 1) / bandCount;
+                size_t decodedFirstUnit = firstUnit > 0 ? firstUnit - 1 : 0;
+                size_t decodedEndUnit = std::min(endUnit + 1, unitCount);
+
+                Band& band = bands[b];
+                band.firstRow = firstUnit * unitRows;
+                band.rowCount = std::min(endUnit * unitRows, layout.height) - band.firstRow;
+                band.skippedRows = band.firstRow - decodedFirstUnit * unitRows;
+                size_t decodedRows = std::min(decodedEndUnit * unitRows, layout.height) - decodedFirstUnit * unitRows;
+
+                //Restart Intervals Covering the Decoded Units, the Last Unit can End Inside an Interval
+                size_t mcusPerUnit = layout.unitMcuRows * layout.mcuColumns;
+                size_t firstInterval = decodedFirstUnit * mcusPerUnit / layout.restartInterval;
+                size_t endMcu = std::min(decodedEndUnit * mcusPerUnit, layout.mcuColumns * layout.mcuRows);
+                size_t endInterval = std::min((endMcu + layout.restartInterval - 1) / layout.restartInterval, layout.intervalBegins.size());
+
+                std::string file;
+                size_t scanBegin = layout.intervalBegins[firstInterval];
+                size_t scanEnd = layout.intervalEnds[endInterval - 1];
+                file.reserve(layout.scanStart + (scanEnd - scanBegin) + 2);
+                file.append(reinterpret_cast<const char*>(data), layout.scanStart);
+                file[layout.heightOffset] = static_cast<char>(decodedRows >> 8);
+                file[layout.heightOffset + 1] = static_cast<char>(decodedRows & 0xFF);
+                file.append(reinterpret_cast<const char*>(data) + scanBegin, scanEnd - scanBegin);
+                file += '\xFF';
+                file += '\xD9';
+
+                band.pixels = stbi_load_from_memory(reinterpret_cast<const stbi_uc*>(file.data()), static_cast<int>(file.size()),
+                    &band.width, &band.height, &band.channels, requestedChannels);
+                if (band.pixels && (static_cast<size_t>(band.width) != layout.width || static_cast<size_t>(band.height) != decodedRows)) {
+                    stbi_image_free(band.pixels);
+                    band.pixels = nullptr;
+                }
+            });
+
+            //A Band that Failed Decodes the Whole Image Again, so the Result and the Failure Reason Match stb_image
+            bool failed = false;
+            for (const Band& band : bands)
+                failed = failed || !band.pixels;
+            int pixelSize = requestedChannels != 0 ? requestedChannels : bands.front().channels;
+            unsigned char* pixels = failed ? nullptr : static_cast<unsigned char*>(malloc(layout.width * layout.height * pixelSize));
+            if (pixels) {
+                size_t rowSize = layout.width * pixelSize;
+                for (const Band& band : bands)
+                    memcpy(pixels + band.firstRow * rowSize, band.pixels + band.skippedRows * rowSize, band.rowCount * rowSize);
+                *width = static_cast<int>(layout.width);
+                *height = static_cast<int>(layout.height);
+                *channels = bands.front().channels;
+            }
+            for (Band& band : bands)
+                stbi_image_free(band.pixels);
+
+            return pixels ? pixels : stbi_load_from_memory(data, static_cast<int>(size), width, height, channels, requestedChannels);
+        }
+
+    private:
+
+        //Layout Struct Holds what Splitting a JPEG Needs to Know about it
+        struct Layout {
+            size_t width = 0;
+            size_t height = 0;
+            size_t heightOffset = 0;
+            size_t mcuHeight = 0;
+            size_t mcuColumns = 0;
+            size_t mcuRows = 0;
+            size_t unitMcuRows = 0;
+            size_t restartInterval = 0;
+            size_t scanStart = 0;
+            std::vector<size_t> intervalBegins;
+            std::vector<size_t> intervalEnds;
+        };
+
+        /**
+         * @brief ReadLayout - Reads the Headers of a JPEG and Finds its Restart Intervals
+         *
+         * @param Data : The Bytes of the File
+         * @param Size : The Number of Bytes
+         * @param Layout : Receives the Layout
+         * @return : True if the File is a Baseline JPEG with a Single Scan and Restart Markers
+         */
+        static bool ReadLayout(const unsigned char* data, size_t size, Layout& layout) {
+            if (size < 4 || data[0] != 0xFF || data[1] != 0xD8)
+                return false;
+
+            size_t componentCount = 0;
+            size_t maxH = 1;
+            size_t maxV = 1;
+            size_t position = 2;
+            while (layout.scanStart == 0) {
+                if (position + 4 > size || data[position] != 0xFF)
+                    return false;
+                unsigned char marker = data[position + 1];
+                if (marker == 0xFF) {
+                    ++position;
+                    continue;
+                }
+                size_t length = (static_cast<size_t>(data[position + 2]) << 8) | data[position + 3];
+                size_t segment = position + 4;
+                if (length < 2 || position + 2 + length > size)
+                    return false;
+
+                //Baseline and Extended Huffman Frames, with 8 Bit Samples
+                if (marker == 0xC0 || marker == 0xC1) {
+                    if (length < 8 || data[segment] != 8)
+                        return false;
+                    layout.heightOffset = segment + 1;
+                    layout.height = (static_cast<size_t>(data[segment + 1]) << 8) | data[segment + 2];
+                    layout.width = (static_cast<size_t>(data[segment + 3]) << 8) | data[segment + 4];
+                    componentCount = data[segment + 5];
+                    if (layout.height == 0 || layout.width == 0 || componentCount == 0 || length < 8 + 3 * componentCount)
+                        return false;
+                    for (size_t c = 0; c < componentCount; ++c) {
+                        unsigned char sampling = data[segment + 7 + 3 * c];
+                        maxH = std::max<size_t>(maxH, sampling >> 4);
+                        maxV = std::max<size_t>(maxV, sampling & 15);
+                    }
+                }
+                //Progressive, Lossless and Arithmetic Frames, and Heights Defined after the Scan
+                else if ((marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC) || marker == 0xDC)
+                    return false;
+                else if (marker == 0xDD) {
+                    if (length != 4)
+                        return false;
+                    layout.restartInterval = (static_cast<size_t>(data[segment]) << 8) | data[segment + 1];
+                }
+                else if (marker == 0xDA) {
+                    if (componentCount == 0 || data[segment] != componentCount)
+                        return false;
+                    layout.scanStart = position + 2 + length;
+                }
+                position += 2 + length;
+            }
+            if (layout.restartInterval == 0)
+                return false;
+
+            //A Scan of a Single Component is Coded in 8x8 Blocks whatever its Sampling
+            size_t mcuWidth = componentCount == 1 ? 8 : 8 * maxH;
+            layout.mcuHeight = componentCount == 1 ? 8 : 8 * maxV;
+            layout.mcuColumns = (layout.width + mcuWidth - 1) / mcuWidth;
+            layout.mcuRows = (layout.height + layout.mcuHeight - 1) / layout.mcuHeight;
+
+            //Fewest MCU Rows Ending on a Restart Marker
+            size_t common = layout.restartInterval;
+            for (size_t other = layout.mcuColumns; other != 0; ) {
+                size_t rest = common % other;
+                common = other;
+                other = rest;
+            }
+            layout.unitMcuRows = layout.restartInterval / common;
+
+            //Walks the Entropy Coded Data, Skipping Stuffed Zeros and Fill Bytes, up to the End of Image
+            layout.intervalBegins.push_back(layout.scanStart);
+            for (position = layout.scanStart; ; ) {
+                const void* found = memchr(data + position, 0xFF, size - position);
+                if (!found)
+                    return false;
+                position = static_cast<const unsigned char*>(found) - data;
+                if (position + 1 >= size)
+                    return false;
+                unsigned char marker = data[position + 1];
+                if (marker == 0x00 || marker == 0xFF) {
+                    position += marker == 0x00 ? 2 : 1;
+                    continue;
+                }
+                layout.intervalEnds.push_back(position);
+                if (marker < 0xD0 || marker > 0xD7)
+                    break;
+                position += 2;
+                layout.intervalBegins.push_back(position);
+            }
+
+            //Any Marker but the End of Image Means more Scans or Tables the Bands would Miss
+            size_t mcuCount = layout.mcuColumns * layout.mcuRows;
+            return data[position + 1] == 0xD9 &&
+                layout.intervalBegins.size() == (mcuCount + layout.restartInterval - 1) / layout.restartInterval;
+        }
+    };
+}
@@ -0,0 +1,327 @@
+#pragma once
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace IMPT {
+
+    /**
+     * @brief JsonValue - A Parsed JSON Value, Objects Keep their Members in File Order
+     */
+    class JsonValue {
+    public:
+
+        enum class Type {
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        /**
+         * @brief Parse - Parses a JSON Document
+         *
+         * @param Begin : The Start of the Text
+         * @param End : The End of the Text
+         * @return : The Root Value, Throws if the Text is not Valid JSON
+         */
+        static JsonValue Parse(const char* begin, const char* end) {
+            Parser parser = { begin, begin, end };
+            JsonValue root = parser.ParseValue(0);
+            parser.SkipWhitespace();
+            if (parser.cursor != end)
+                parser.Fail("Unexpected text after the JSON value");
+            return root;
+        }
+
+        Type GetType() const { return type; }
+        bool IsNumber() const { return type == Type::Number; }
+        bool IsString() const { return type == Type::String; }
+        bool IsArray() const { return type == Type::Array; }
+        bool IsObject() const { return type == Type::Object; }
+
+        double Number() const { return number; }
+        bool Bool() const { return boolean; }
+        const std::string& String() const { return text; }
+
+        /**
+         * @brief Size - The Number of Elements of an Array, or Members of an Object
+         *
+         * @return : The Size, 0 for other Types
+         */
+        size_t Size() const { return type == Type::Array ? elements.size() : members.size(); }
+
+        /**
+         * @brief At - An Element of an Array
+         *
+         * @param Index : The Index of the Element
+         * @return : The Element, Throws if this is not an Array or the Index is Out of Range
+         */
+        const JsonValue& At(size_t index) const {
+            if (type != Type::Array || index >= elements.size())
+                throw std::runtime_error("JSON array index out of range");
+            return elements[index];
+        }
+
+        /**
+         * @brief Find - A Member of an Object
+         *
+         * @param Key : The Name of the Member
+         * @return : The Member, or Null if this is not an Object or has no such Member
+         */
+        const JsonValue* Find(std::string_view key) const {
+            for (const auto& member : members) {
+                if (member.first == key)
+                    return &member.second;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief NumberOr - The Number Held by a Member of an Object
+         *
+         * @param Key : The Name of the Member
+         * @param Fallback : The Value if the Member is Missing or not a Number
+         * @return : The Number
+         */
+        double NumberOr(std::string_view key, double fallback) const {
+            const JsonValue* value = Find(key);
+            return value && value->IsNumber() ? value->number : fallback;
+        }
+
+    private:
+
+        //Recursive Descent over the Text, Nesting is Bounded so Hostile Files can't Exhaust the Stack
+        struct Parser {
+            static constexpr int MAX_DEPTH = 256;
+
+            const char* begin;
+            const char* cursor;
+            const char* end;
+
+            [[noreturn]] void Fail(const char* message) const {
+                throw std::runtime_error(std::string(message) + " at JSON offset " + std::to_string(cursor - begin));
+            }
+
+            void SkipWhitespace() {
+                while (cursor < end && (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r'))
+                    ++cursor;
+            }
+
+            void Expect(std::string_view literal) {
+                if (static_cast<size_t>(end - cursor) < literal.size() || std::string_view(cursor, literal.size()) != literal)
+                    Fail("Invalid JSON literal");
+                cursor += literal.size();
+            }
+
+            JsonValue ParseValue(int depth) {
+                if (depth > MAX_DEPTH)
+                    Fail("JSON nesting is too deep");
+
+                SkipWhitespace();
+                if (cursor == end)
+                    Fail("Unexpected end of JSON");
+
+                JsonValue value;
+                switch (*cursor) {
+                case '{':
+                    value.type = Type::Object;
+                    ++cursor;
+                    SkipWhitespace();
+                    if (cursor < end && *cursor == '}') {
+                        ++cursor;
+                        break;
+                    }
+                    for (;;) {
+                        SkipWhitespace();
+                        std::string key = ParseString();
+                        SkipWhitespace();
+                        if (cursor == end || *cursor != ':')
+                            Fail("Expected ':' in JSON object");
+                        ++cursor;
+                        value.members.emplace_back(std::move(key), ParseValue(depth + 1));
+                        SkipWhitespace();
+                        if (cursor < end && *cursor == ',') {
+                            ++cursor;
+                            continue;
+                        }
+                        if (cursor < end && *cursor == '}') {
+                            ++cursor;
+                            break;
+                        }
+                        Fail("Expected ',' or '}' in JSON object");
+                    }
+                    break;
+                case '[':
+                    value.type = Type::Array;
+                    ++cursor;
+                    SkipWhitespace();
+                    if (cursor < end && *cursor == ']') {
+                        ++cursor;
+                        break;
+                    }
+                    for (;;) {
+                        value.elements.push_back(ParseValue(depth + 1));
+                        SkipWhitespace();
+                        if (cursor < end && *cursor == ',') {
+                            ++cursor;
+                            continue;
+                        }
+                        if (cursor < end && *cursor == ']') {
+                            ++cursor;
+                            break;
+                        }
+                        Fail("Expected ',' or ']' in JSON array");
+                    }
+                    break;
+                case '"':
+                    value.type = Type::String;
+                    value.text = ParseString();
+                    break;
+                case 't':
+                    Expect("true");
+                    value.type = Type::Bool;
+                    value.boolean = true;
+                    break;
+                case 'f':
+                    Expect("false");
+                    value.type = Type::Bool;
+                    break;
+                case 'n':
+                    Expect("null");
+                    break;
+                default:
+                    value.type = Type::Number;
+                    value.number = ParseNumber();
+                    break;
+                }
+                return value;
+            }
+
+            double ParseNumber() {
+                //JSON Numbers are a Subset of what from_chars Accepts, once "inf" and "nan" are Ruled Out
+                const char* digits = cursor < end && *cursor == '-' ? cursor + 1 : cursor;
+                if (digits == end || *digits < '0' || *digits > '9')
+                    Fail("Invalid JSON number");
+
+                double number = 0.0;
+                std::from_chars_result result = std::from_chars(cursor, end, number);
+                if (result.ec != std::errc())
+                    Fail("Invalid JSON number");
+                cursor = result.ptr;
+                return number;
+            }
+
+            std::string ParseString() {
+                if (cursor == end || *cursor != '"')
+                    Fail("Expected a JSON string");
+                ++cursor;
+
+                std::string text;
+                for (;;) {
+                    //Copies the Run up to the Next Quote or Escape at once
+                    const char* run = cursor;
+                    while (cursor < end && *cursor != '"' && *cursor != '\\') {
+                        if (static_cast<unsigned char>(*cursor) < 0x20)
+                            Fail("Control character in JSON string");
+                        ++cursor;
+                    }
+                    text.append(run, cursor);
+
+                    if (cursor == end)
+                        Fail("Unterminated JSON string");
+                    if (*cursor++ == '"')
+                        return text;
+
+                    if (cursor == end)
+                        Fail("Unterminated JSON string");
+                    char escape = *cursor++;
+                    switch (escape) {
+                    case '"': text += '"'; break;
+                    case '\\': text += '\\'; break;
+                    case '/': text += '/'; break;
+                    case 'b': text += '\b'; break;
+                    case 'f': text += '\f'; break;
+                    case 'n': text += '\n'; break;
+                    case 'r': text += '\r'; break;
+                    case 't': text += '\t'; break;
+                    case 'u': AppendUtf8(text, ParseCodePoint()); break;
+                    default: Fail("Invalid JSON escape");
+                    }
+                }
+            }
+
+            uint32_t ParseHex4() {
+                if (end - cursor < 4)
+                    Fail("Invalid JSON unicode escape");
+                uint32_t value = 0;
+                for (int i = 0; i < 4; ++i) {
+                    char digit = *cursor++;
+                    value <<= 4;
+                    if (digit >= '0' && digit <= '9')
+                        value |= static_cast<uint32_t>(digit - '0');
+                    else if (digit >= 'a' && digit <= 'f')
+                        value |= static_cast<uint32_t>(digit - 'a' + 10);
+                    else if (digit >= 'A' && digit <= 'F')
+                        value |= static_cast<uint32_t>(digit - 'A' + 10);
+                    else
+                        Fail("Invalid JSON unicode escape");
+                }
+                return value;
+            }
+
+            uint32_t ParseCodePoint() {
+                uint32_t codePoint = ParseHex4();
+
+                //Characters Outside the Basic Plane are Written as a Surrogate Pair
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+                    if (end - cursor < 2 || cursor[0] != '\\' || cursor[1] != 'u')
+                        Fail("Unpaired JSON surrogate");
+                    cursor += 2;
+                    uint32_t low = ParseHex4();
+                    if (low < 0xDC00 || low > 0xDFFF)
+                        Fail("Unpaired JSON surrogate");
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                }
+                else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+                    Fail("Unpaired JSON surrogate");
+                }
+                return codePoint;
+            }
+
+            static void AppendUtf8(std::string& text, uint32_t codePoint) {
+                if (codePoint < 0x80) {
+                    text += static_cast<char>(codePoint);
+                }
+                else if (codePoint < 0x800) {
+                    text += static_cast<char>(0xC0 | (codePoint >> 6));
+                    text += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+                else if (codePoint < 0x10000) {
+                    text += static_cast<char>(0xE0 | (codePoint >> 12));
+                    text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    text += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+                else {
+                    text += static_cast<char>(0xF0 | (codePoint >> 18));
+                    text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                    text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                    text += static_cast<char>(0x80 | (codePoint & 0x3F));
+                }
+            }
+        };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string text;
+        std::vector<JsonValue> elements;
+        std::vector<std::pair<std::string, JsonValue>> members;
+    };
+}
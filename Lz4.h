@@ -0,0 +1,183 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace IMPT {
+
+    /**
+     * @brief Lz4Compress - Compresses a Block in the LZ4 Block Format
+     *
+     * A Greedy Single Pass Matcher with a Hash Table of 4 Byte Sequences, which Skips Ahead Faster the
+     * Longer it Goes without a Match, so Incompressible Data such as JPEG Files Costs Little Time.
+     *
+     * @param Source : The Bytes to Compress
+     * @param Size : The Number of Bytes
+     * @param Destination : Receives the Compressed Block
+     * @return : Void
+     */
+    inline void Lz4Compress(const char* source, size_t size, std::string& destination) {
+        //Limits of the Format, the Last 5 Bytes are Always Literals and no Match Starts in the Last 12
+        const size_t MIN_MATCH = 4;
+        const size_t LAST_LITERALS = 5;
+        const size_t MATCH_START_LIMIT = 12;
+        const size_t MAX_OFFSET = 65535;
+        const int HASH_BITS = 16;
+
+        const unsigned char* input = reinterpret_cast<const unsigned char*>(source);
+        const unsigned char* end = input + size;
+        const unsigned char* anchor = input;
+
+        destination.clear();
+        destination.reserve(size + size / 255 + 16);
+
+        auto read32 = [](const unsigned char* p) {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        };
+        auto writeLength = [&destination](size_t length) {
+            for (; length >= 255; length -= 255)
+                destination += static_cast<char>(255);
+            destination += static_cast<char>(length);
+        };
+        auto emit = [&](const unsigned char* literals, size_t literalCount, size_t offset, size_t matchLength) {
+            size_t matchCode = matchLength - MIN_MATCH;
+            unsigned char token = static_cast<unsigned char>((std::min<size_t>(literalCount, 15) << 4) | std::min<size_t>(matchCode, 15));
+            destination += static_cast<char>(token);
+            if (literalCount >= 15)
+                writeLength(literalCount - 15);
+            destination.append(reinterpret_cast<const char*>(literals), literalCount);
+            destination += static_cast<char>(offset & 0xFF);
+            destination += static_cast<char>(offset >> 8);
+            if (matchCode >= 15)
+                writeLength(matchCode - 15);
+        };
+
+        if (size > MATCH_START_LIMIT) {
+            //Positions are Stored Plus One, so Zero Marks an Empty Slot
+            std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+            const unsigned char* matchEnd = end - LAST_LITERALS;
+            const unsigned char* startEnd = end - MATCH_START_LIMIT;
+            const unsigned char* cursor = input;
+
+            while (cursor <= startEnd) {
+                uint32_t sequence = read32(cursor);
+                uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+                uint32_t candidate = table[hash];
+                table[hash] = static_cast<uint32_t>(cursor - input) + 1;
+
+                const unsigned char* match = candidate == 0 ? nullptr : input + (candidate - 1);
+                if (!match || static_cast<size_t>(cursor - match) > MAX_OFFSET || read32(match) != sequence) {
+                    cursor += 1 + (static_cast<size_t>(cursor - anchor) >> 6);
+                    continue;
+                }
+
+                //Grows the Match Backwards into the Pending Literals, then Forwards
+                while (cursor > anchor && match > input && cursor[-1] == match[-1]) {
+                    --cursor;
+                    --match;
+                }
+                size_t length = MIN_MATCH;
+                while (cursor + length < matchEnd && cursor[length] == match[length])
+                    ++length;
+
+                emit(anchor, static_cast<size_t>(cursor - anchor), static_cast<size_t>(cursor - match), length);
+                cursor += length;
+                anchor = cursor;
+            }
+        }
+
+        //The Block Ends with a Sequence of only Literals
+        size_t literalCount = static_cast<size_t>(end - anchor);
+        destination += static_cast<char>(std::min<size_t>(literalCount, 15) << 4);
+        if (literalCount >= 15)
+            writeLength(literalCount - 15);
+        destination.append(reinterpret_cast<const char*>(anchor), literalCount);
+    }
+
+    /**
+     * @brief Lz4Decompress - Decompresses a Block in the LZ4 Block Format
+     *
+     * Every Length and Offset is Checked, so a Corrupt Block Fails instead of Reading or Writing Out of Bounds.
+     *
+     * @param Source : The Compressed Block
+     * @param SourceSize : The Size of the Compressed Block
+     * @param Destination : Receives the Decompressed Bytes
+     * @param Size : The Exact Decompressed Size
+     * @return : False if the Block is Corrupt or doesn't Decompress to Exactly Size Bytes
+     */
+    inline bool Lz4Decompress(const char* source, size_t sourceSize, char* destination, size_t size) {
+        const unsigned char* input = reinterpret_cast<const unsigned char*>(source);
+        const unsigned char* inputEnd = input + sourceSize;
+        unsigned char* output = reinterpret_cast<unsigned char*>(destination);
+        unsigned char* outputStart = output;
+        unsigned char* outputEnd = output + size;
+
+        auto readLength = [&](size_t& length) {
+            unsigned char byte;
+            do {
+                if (input == inputEnd || length > size)
+                    return false;
+                byte = *input++;
+                length += byte;
+            } while (byte == 255);
+            return true;
+        };
+
+        for (;;) {
+            if (input == inputEnd)
+                return false;
+            unsigned char token = *input++;
+
+            size_t literalCount = token >> 4;
+            if (literalCount == 15 && !readLength(literalCount))
+                return false;
+            if (literalCount > static_cast<size_t>(inputEnd - input) || literalCount > static_cast<size_t>(outputEnd - output))
+                return false;
+
+            //Short Runs, the Common Case, are Copied as a Fixed 16 Bytes when there is Room
+            if (literalCount <= 16 && inputEnd - input >= 16 && outputEnd - output >= 16)
+                std::memcpy(output, input, 16);
+            else
+                std::memcpy(output, input, literalCount);
+            input += literalCount;
+            output += literalCount;
+
+            //Only the Last Sequence has no Match
+            if (input == inputEnd)
+                return output == outputEnd;
+
+            if (inputEnd - input < 2)
+                return false;
+            size_t offset = static_cast<size_t>(input[0]) | static_cast<size_t>(input[1]) << 8;
+            input += 2;
+            if (offset == 0 || offset > static_cast<size_t>(output - outputStart))
+                return false;
+
+            size_t length = token & 15;
+            if (length == 15 && !readLength(length))
+                return false;
+            length += 4;
+            if (length > static_cast<size_t>(outputEnd - output))
+                return false;
+
+            //Overlapping Matches Repeat the Last Offset Bytes, so they are Copied in Order, 8 Bytes at a Time
+            //when the Offset Allows it and there is Room to Copy Past the End of the Match
+            const unsigned char* match = output - offset;
+            if (offset >= 8 && static_cast<size_t>(outputEnd - output) >= length + 8) {
+                unsigned char* matchEnd = output + length;
+                for (; output < matchEnd; output += 8, match += 8)
+                    std::memcpy(output, match, 8);
+                output = matchEnd;
+            }
+            else {
+                for (size_t i = 0; i < length; ++i)
+                    *output++ = match[i];
+            }
+        }
+    }
+}
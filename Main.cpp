@@ -1,5 +1,6 @@
 ﻿#include <iostream>
 #include <vector>
+#include <cstdlib>
 
 #define GLEW_STATIC
 #include <GL/glew.h>
@@ -10,6 +11,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include "Input.h"
 #include "Importer.h"
+#include "Impostor.h"
 #include <random>
 
 
@@ -207,7 +209,19 @@ void windowSetSpace(GLFWwindow* window, int* screenWidth, int* screenHeight) {
 /**
  * @brief Main - Program Initialization and Rendering loop
  */
-int main(void) {
+int main(int argc, char** argv) {
+
+    //Packs a Folder into an Archive Instead of Running: --pack PoolBalls/ PoolBalls.p3dpak
+    if (argc == 4 && std::string(argv[1]) == "--pack")
+        return IMPT::Archive::Pack(argv[2], argv[3]) ? 0 : 1;
+
+    //Prints the Vertex Cache Statistics of a Model Instead of Running: --mesh-stats PoolBalls/Ball1.obj
+    if (argc == 3 && std::string(argv[1]) == "--mesh-stats")
+        return IMPT::ObjectLoader::ReportMeshStatistics(argv[2]) ? 0 : 1;
+
+    //Times the Decoding of the Texture Images Instead of Running: --decode-times PoolBalls/ 20
+    if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--decode-times")
+        return IMPT::ObjectLoader::ReportDecodeTimes(argv[2], argc == 4 ? std::atoi(argv[3]) : 10) ? 0 : 1;
 
     int screenWidth = 1280;
     int screenHeight = 720;
@@ -282,8 +296,15 @@ int main(void) {
 	std::vector<glm::vec3> ballPositions;
 
 
-    std::vector<std::pair<std::vector<IMPT::ObjectLoader::Vertex>, IMPT::ObjectLoader::Material>> ObjectDataList = IMPT::ObjectLoader::Read("PoolBalls/");
-    std::vector<GLuint> vboIDs = IMPT::ObjectLoader::Send(ObjectDataList);
+    std::vector<IMPT::ObjectLoader::ObjectData> ObjectDataList = IMPT::ObjectLoader::Read("PoolBalls/");
+    std::vector<IMPT::ObjectLoader::MeshBuffers> meshBuffersList = IMPT::ObjectLoader::Send(ObjectDataList, IMPT::ObjectLoader::VertexFormat::Packed);
+
+    //The Level of Detail each Ball was Drawn with Last Frame
+    std::vector<size_t> ballLodLevels(ObjectDataList.size(), 0);
+
+    //Balls can also be Drawn as Ray Cast Quads, Toggled with I
+    IMPT::SphereImpostor ballImpostor;
+    ballImpostor.Create("ImpostorVertexShader.glsl", "ImpostorFragmentShader.glsl");
 
     for (auto& ObjectData : ObjectDataList){
         const float x = dist(gen) * 2;
@@ -368,7 +389,11 @@ int main(void) {
 
 		//Render each Ball
 		for (size_t i = 0; i < ObjectDataList.size(); ++i) {
-            IMPT::ObjectLoader::Draw(ballPositions[i], glm::vec3(ballPositions[i].y * 45, ballPositions[i].x * 45, 0), ObjectDataList[i], vboIDs[i]/*, shaderProgram*/);
+            const glm::vec3 ballOrientation(ballPositions[i].y * 45, ballPositions[i].x * 45, 0);
+            if (impostorEnable && ballImpostor.IsReady())
+                ballImpostor.Draw(ballPositions[i], ballOrientation, ObjectDataList[i]);
+            else
+                IMPT::ObjectLoader::Draw(ballPositions[i], ballOrientation, ObjectDataList[i], meshBuffersList[i], &ballLodLevels[i]/*, shaderProgram*/);
 		}
 
         //Render the Lights
@@ -382,9 +407,11 @@ int main(void) {
 
     }
 
-    //Deletes the Vertex Buffer Objects
-    for (GLuint vbo : vboIDs)
-        glDeleteBuffers(1, &vbo);
+    //Deletes the Vertex and Index Buffer Objects
+    IMPT::ObjectLoader::DeleteBuffers(meshBuffersList);
+
+    //Deletes the Impostor Shader and Quad
+    ballImpostor.Delete();
 
     //Destroy the GLFW Window
     glfwDestroyWindow(window);
@@ -0,0 +1,161 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace IMPT {
+    class MappedFile {
+    public:
+
+        /**
+         * @brief MappedFile - Maps a File Read-Only into Memory
+         *
+         * @param Path : The Path of the File to Map
+         */
+        explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+            fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (fileHandle == INVALID_HANDLE_VALUE)
+                return;
+
+            LARGE_INTEGER fileSize;
+            if (!GetFileSizeEx(fileHandle, &fileSize)) {
+                Close();
+                return;
+            }
+            size = static_cast<size_t>(fileSize.QuadPart);
+            opened = true;
+
+            //Empty Files can't be Mapped, but are still Valid
+            if (size == 0)
+                return;
+
+            mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mappingHandle)
+                data = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+            fileDescriptor = open(path.c_str(), O_RDONLY);
+            if (fileDescriptor < 0)
+                return;
+
+            struct stat fileStat;
+            if (fstat(fileDescriptor, &fileStat) != 0) {
+                Close();
+                return;
+            }
+            size = static_cast<size_t>(fileStat.st_size);
+            opened = true;
+
+            //Empty Files can't be Mapped, but are still Valid
+            if (size == 0)
+                return;
+
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            if (mapping != MAP_FAILED) {
+                data = static_cast<const char*>(mapping);
+                madvise(mapping, size, MADV_SEQUENTIAL);
+            }
+#endif
+            //The File Opened but the Mapping Failed
+            if (!data) {
+                Close();
+            }
+        }
+
+        ~MappedFile() {
+            Close();
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief IsOpen - Checks if the File was Successfully Mapped
+         *
+         * @return : True if the Contents can be Read
+         */
+        bool IsOpen() const {
+            return opened;
+        }
+
+        /**
+         * @brief Begin - The First Byte of the File
+         *
+         * @return : Pointer to the Start of the Mapping
+         */
+        const char* Begin() const {
+            return data;
+        }
+
+        /**
+         * @brief End - One Past the Last Byte of the File
+         *
+         * @return : Pointer to the End of the Mapping
+         */
+        const char* End() const {
+            return data + size;
+        }
+
+        /**
+         * @brief Size - The Size of the File in Bytes
+         *
+         * @return : Size of the Mapping
+         */
+        size_t Size() const {
+            return size;
+        }
+
+    private:
+
+        /**
+         * @brief Close - Unmaps the File and Releases the Handles
+         *
+         * @return : Void
+         */
+        void Close() {
+#ifdef _WIN32
+            if (data)
+                UnmapViewOfFile(data);
+            if (mappingHandle)
+                CloseHandle(mappingHandle);
+            if (fileHandle != INVALID_HANDLE_VALUE)
+                CloseHandle(fileHandle);
+            mappingHandle = nullptr;
+            fileHandle = INVALID_HANDLE_VALUE;
+#else
+            if (data)
+                munmap(const_cast<char*>(data), size);
+            if (fileDescriptor >= 0)
+                close(fileDescriptor);
+            fileDescriptor = -1;
+#endif
+            data = nullptr;
+            size = 0;
+            opened = false;
+        }
+
+        const char* data = nullptr;
+        size_t size = 0;
+        bool opened = false;
+#ifdef _WIN32
+        HANDLE fileHandle = INVALID_HANDLE_VALUE;
+        HANDLE mappingHandle = nullptr;
+#else
+        int fileDescriptor = -1;
+#endif
+    };
+}
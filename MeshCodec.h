@@ -0,0 +1,313 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+//x86 Targets Always have SSE2 on 64 Bit
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define IMPT_CODEC_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace IMPT {
+
+    /**
+     * @brief MeshCodec - Lossless Compression of Vertex and Index Buffers
+     *
+     * A Buffer is Seen as Records of 32 Bit Words, each Word Predicted by the Same Word of the Previous Record.
+     * The Zigzag Coded Differences are Split into Byte Planes, and every Group of 16 Bytes of a Plane is Stored
+     * with the Fewest Bits (0, 2, 4 or 8) that Hold all of them, so Constant Attributes Cost Nothing and the
+     * High Bytes of Nearby Values Cost Little. Decoding Unpacks a Group of 16 Records per Step with SSE2.
+     *
+     * The Stream is a Version Byte followed by Blocks of up to BLOCK_RECORDS Records, each Holding, for every
+     * Word and every Byte Plane, 2 Bits of Width per Group and then the Packed Groups.
+     */
+    class MeshCodec {
+    public:
+
+        //Version of the Stream Layout, Bumped whenever it Changes
+        static constexpr uint8_t VERSION = 1;
+
+        //Records per Block, a Multiple of the Group Size, Small Enough for a Decoded Block to Stay in the L1 Cache
+        static constexpr size_t BLOCK_RECORDS = 256;
+
+        //Bytes Packed Together with the Same Width
+        static constexpr size_t GROUP_SIZE = 16;
+
+        //Largest Record, in Bytes
+        static constexpr size_t MAX_RECORD_SIZE = 256;
+
+        /**
+         * @brief EncodeVertices - Compresses a Vertex Buffer
+         *
+         * @param Vertices : The Vertices
+         * @param VertexCount : The Number of Vertices
+         * @param VertexSize : The Size of a Vertex in Bytes, a Multiple of 4 up to MAX_RECORD_SIZE
+         * @param Encoded : Receives the Stream
+         * @return : Void
+         */
+        static void EncodeVertices(const void* vertices, size_t vertexCount, size_t vertexSize, std::string& encoded) {
+            const size_t wordCount = vertexSize / 4;
+            const unsigned char* records = static_cast<const unsigned char*>(vertices);
+
+            encoded.clear();
+            encoded.reserve(1 + vertexCount * vertexSize / 2);
+            encoded += static_cast<char>(VERSION);
+
+            uint32_t previous[MAX_RECORD_SIZE / 4] = {};
+            unsigned char planes[4][BLOCK_RECORDS];
+            for (size_t blockStart = 0; blockStart < vertexCount; blockStart += BLOCK_RECORDS) {
+                size_t count = std::min(BLOCK_RECORDS, vertexCount - blockStart);
+                size_t paddedCount = (count + GROUP_SIZE - 1) / GROUP_SIZE * GROUP_SIZE;
+
+                for (size_t w = 0; w < wordCount; ++w) {
+                    //Records Past the End of the Buffer Repeat the Last One, so their Differences are Zero
+                    for (size_t i = 0; i < paddedCount; ++i) {
+                        uint32_t word = previous[w];
+                        if (i < count)
+                            std::memcpy(&word, records + (blockStart + i) * vertexSize + w * 4, 4);
+                        uint32_t difference = word - previous[w];
+                        uint32_t zigzag = (difference << 1) ^ static_cast<uint32_t>(-static_cast<int32_t>(difference >> 31));
+                        previous[w] = word;
+                        for (int b = 0; b < 4; ++b)
+                            planes[b][i] = static_cast<unsigned char>(zigzag >> (8 * b));
+                    }
+                    for (int b = 0; b < 4; ++b)
+                        EncodePlane(planes[b], paddedCount, encoded);
+                }
+            }
+        }
+
+        /**
+         * @brief DecodeVertices - Decompresses a Vertex Buffer
+         *
+         * Every Width and Size is Checked, so a Corrupt Stream Fails instead of Reading or Writing Out of Bounds.
+         *
+         * @param Vertices : Receives the Vertices
+         * @param VertexCount : The Number of Vertices
+         * @param VertexSize : The Size of a Vertex in Bytes, a Multiple of 4 up to MAX_RECORD_SIZE
+         * @param Encoded : The Stream
+         * @param EncodedSize : The Size of the Stream
+         * @return : False if the Stream is Corrupt or doesn't Decode to Exactly VertexCount Vertices
+         */
+        static bool DecodeVertices(void* vertices, size_t vertexCount, size_t vertexSize, const char* encoded, size_t encodedSize) {
+            const size_t wordCount = vertexSize / 4;
+            if (vertexSize % 4 != 0 || vertexSize == 0 || vertexSize > MAX_RECORD_SIZE)
+                return false;
+
+            const unsigned char* cursor = reinterpret_cast<const unsigned char*>(encoded);
+            const unsigned char* end = cursor + encodedSize;
+            if (cursor == end || *cursor++ != VERSION)
+                return false;
+
+            unsigned char* records = static_cast<unsigned char*>(vertices);
+            uint32_t previous[MAX_RECORD_SIZE / 4] = {};
+            for (size_t blockStart = 0; blockStart < vertexCount; blockStart += BLOCK_RECORDS) {
+                size_t count = std::min(BLOCK_RECORDS, vertexCount - blockStart);
+                size_t groupCount = (count + GROUP_SIZE - 1) / GROUP_SIZE;
+                unsigned char* block = records + blockStart * vertexSize;
+
+                for (size_t w = 0; w < wordCount; ++w) {
+                    //Finds where the Groups of each Plane Start, so the Four Planes can be Walked Together
+                    const unsigned char* headers[4];
+                    const unsigned char* groups[4];
+                    for (int b = 0; b < 4; ++b) {
+                        size_t headerSize = (groupCount + 3) / 4;
+                        if (static_cast<size_t>(end - cursor) < headerSize)
+                            return false;
+                        headers[b] = cursor;
+                        groups[b] = cursor + headerSize;
+                        size_t payloadSize = 0;
+                        for (size_t g = 0; g < groupCount; ++g)
+                            payloadSize += GroupSize(WidthOf(headers[b], g));
+                        if (static_cast<size_t>(end - groups[b]) < payloadSize)
+                            return false;
+                        cursor = groups[b] + payloadSize;
+                    }
+
+#if IMPT_CODEC_SSE2
+                    DecodeWordSse2(headers, groups, groupCount, count, block + w * 4, vertexSize, previous[w]);
+#else
+                    DecodeWordScalar(headers, groups, groupCount, count, block + w * 4, vertexSize, previous[w]);
+#endif
+                }
+            }
+            return cursor == end;
+        }
+
+        /**
+         * @brief MaxRecordCount - The Most Records a Stream of a Given Size can Decode to
+         *
+         * Every Block Stores at Least one Header Byte per Byte Plane of each Word, which Bounds the Block Count.
+         *
+         * @param EncodedSize : The Size of the Stream
+         * @param RecordSize : The Size of a Record in Bytes
+         * @return : The Largest Record Count, Used to Reject Corrupt Counts before Allocating
+         */
+        static size_t MaxRecordCount(size_t encodedSize, size_t recordSize) {
+            size_t wordCount = std::max<size_t>(recordSize / 4, 1);
+            return encodedSize / (4 * wordCount) * BLOCK_RECORDS;
+        }
+
+        /**
+         * @brief EncodeIndices -Compresses an Index Buffer, Each Index Predicted by the One Before
+         *
+         * @param Indices : The Indices
+         * @param IndexCount : The Number of Indices
+         * @param Encoded : Receives the Stream
+         * @return : Void
+         */
+        static void EncodeIndices(const uint32_t* indices, size_t indexCount, std::string& encoded) {
+            EncodeVertices(indices, indexCount, sizeof(uint32_t), encoded);
+        }
+
+        /**
+         * @brief DecodeIndices - Decompresses an Index Buffer
+         *
+         * @param Indices : Receives the Indices
+         * @param IndexCount : The Number of Indices
+         * @param Encoded : The Stream
+         * @param EncodedSize : The Size of the Stream
+         * @return : False if the Stream is Corrupt or doesn't Decode to Exactly IndexCount Indices
+         */
+        static bool DecodeIndices(uint32_t* indices, size_t indexCount, const char* encoded, size_t encodedSize) {
+            return DecodeVertices(indices, indexCount, sizeof(uint32_t), encoded, encodedSize);
+        }
+
+        /**
+         * @brief DecodeWordScalar - Decodes one Word of the Records of a Block, One Record at a Time
+         *
+         * @param Headers : The Group Widths of each Byte Plane
+         * @param Groups : The Packed Groups of each Byte Plane
+         * @param GroupCount : The Number of Groups
+         * @param Count : The Number of Records in the Block
+         * @param Destination : The Word in the First Record
+         * @param Stride : The Size of a Record
+         * @param Previous : The Word of the Previous Record, Updated to the Last Record of the Block
+         * @return : Void
+         */
+        static void DecodeWordScalar(const unsigned char* const* headers, const unsigned char* const* groups, size_t groupCount, size_t count, unsigned char* destination, size_t stride, uint32_t& previous) {
+            const unsigned char* cursors[4] = { groups[0], groups[1], groups[2], groups[3] };
+            unsigned char planes[4][GROUP_SIZE];
+            for (size_t g = 0; g < groupCount; ++g) {
+                for (int b = 0; b < 4; ++b) {
+                    unsigned width = WidthOf(headers[b], g);
+                    for (size_t i = 0; i < GROUP_SIZE; ++i)
+                        planes[b][i] = width == 0 ? 0 : static_cast<unsigned char>(cursors[b][i * width / 8] >> (i * width % 8) & ((1u << width) - 1));
+                    cursors[b] += GroupSize(width);
+                }
+
+                size_t groupEnd = std::min(GROUP_SIZE, count - g * GROUP_SIZE);
+                for (size_t i = 0; i < groupEnd; ++i) {
+                    uint32_t zigzag = planes[0][i] | planes[1][i] << 8 | planes[2][i] << 16 | static_cast<uint32_t>(planes[3][i]) << 24;
+                    previous += (zigzag >> 1) ^ static_cast<uint32_t>(-static_cast<int32_t>(zigzag & 1));
+                    std::memcpy(destination + (g * GROUP_SIZE + i) * stride, &previous, 4);
+                }
+            }
+        }
+
+    private:
+
+        static unsigned WidthOf(const unsigned char* header, size_t group) {
+            static const unsigned char WIDTHS[4] = { 0, 2, 4, 8 };
+            return WIDTHS[header[group / 4] >> (group % 4 * 2) & 3];
+        }
+
+        static size_t GroupSize(unsigned width) {
+            return GROUP_SIZE * width / 8;
+        }
+
+        static void EncodePlane(const unsigned char* plane, size_t count, std::string& encoded) {
+            size_t groupCount = count / GROUP_SIZE;
+            size_t headerStart = encoded.size();
+            encoded.append((groupCount + 3) / 4, '\0');
+
+            for (size_t g = 0; g < groupCount; ++g) {
+                const unsigned char* group = plane + g * GROUP_SIZE;
+                unsigned char largest = *std::max_element(group, group + GROUP_SIZE);
+                unsigned code = largest == 0 ? 0 : largest < 4 ? 1 : largest < 16 ? 2 : 3;
+                unsigned width = code == 0 ? 0 : 1u << code;
+                encoded[headerStart + g / 4] = static_cast<char>(encoded[headerStart + g / 4] | code << (g % 4 * 2));
+
+                //Values are Packed from the Low Bits of each Byte Up
+                unsigned char packed[GROUP_SIZE] = {};
+                for (size_t i = 0; i < GROUP_SIZE && width != 0; ++i)
+                    packed[i * width / 8] = static_cast<unsigned char>(packed[i * width / 8] | group[i] << (i * width % 8));
+                encoded.append(reinterpret_cast<const char*>(packed), GroupSize(width));
+            }
+        }
+
+#if IMPT_CODEC_SSE2
+        static __m128i UnpackGroup(const unsigned char* cursor, unsigned width) {
+            if (width == 8)
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+            if (width == 0)
+                return _mm_setzero_si128();
+
+            if (width == 4) {
+                __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(cursor));
+                __m128i low = _mm_and_si128(bytes, _mm_set1_epi8(0x0F));
+                __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F));
+                return _mm_unpacklo_epi8(low, high);
+            }
+
+            int32_t word;
+            std::memcpy(&word, cursor, 4);
+            __m128i bytes = _mm_cvtsi32_si128(word);
+            __m128i mask = _mm_set1_epi8(0x03);
+            __m128i value0 = _mm_and_si128(bytes, mask);
+            __m128i value1 = _mm_and_si128(_mm_srli_epi16(bytes, 2), mask);
+            __m128i value2 = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+            __m128i value3 = _mm_and_si128(_mm_srli_epi16(bytes, 6), mask);
+            return _mm_unpacklo_epi16(_mm_unpacklo_epi8(value0, value1), _mm_unpacklo_epi8(value2, value3));
+        }
+
+        static void DecodeWordSse2(const unsigned char* const* headers, const unsigned char* const* groups, size_t groupCount, size_t count, unsigned char* destination, size_t stride, uint32_t& previous) {
+            const unsigned char* cursors[4] = { groups[0], groups[1], groups[2], groups[3] };
+            const __m128i one = _mm_set1_epi32(1);
+            __m128i carry = _mm_set1_epi32(static_cast<int32_t>(previous));
+
+            for (size_t g = 0; g < groupCount; ++g) {
+                __m128i planes[4];
+                for (int b = 0; b < 4; ++b) {
+                    unsigned width = WidthOf(headers[b], g);
+                    planes[b] = UnpackGroup(cursors[b], width);
+                    cursors[b] += GroupSize(width);
+                }
+
+                //Interleaves the Planes back into 16 Words, Four per Register
+                __m128i low01 = _mm_unpacklo_epi8(planes[0], planes[1]);
+                __m128i high01 = _mm_unpackhi_epi8(planes[0], planes[1]);
+                __m128i low23 = _mm_unpacklo_epi8(planes[2], planes[3]);
+                __m128i high23 = _mm_unpackhi_epi8(planes[2], planes[3]);
+                __m128i words[4] = {
+                    _mm_unpacklo_epi16(low01, low23), _mm_unpackhi_epi16(low01, low23),
+                    _mm_unpacklo_epi16(high01, high23), _mm_unpackhi_epi16(high01, high23)
+                };
+
+                size_t groupEnd = std::min(GROUP_SIZE, count - g * GROUP_SIZE);
+                unsigned char* output = destination + g * GROUP_SIZE * stride;
+                for (size_t r = 0; r < 4 && r * 4 < groupEnd; ++r) {
+                    //Undoes the Zigzag, then Adds the Differences Up with a Prefix Sum
+                    __m128i zigzag = words[r];
+                    __m128i value = _mm_xor_si128(_mm_srli_epi32(zigzag, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(zigzag, one)));
+                    value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+                    value = _mm_add_epi32(value, _mm_slli_si128(value, 8));
+                    value = _mm_add_epi32(value, carry);
+                    carry = _mm_shuffle_epi32(value, 0xFF);
+
+                    size_t lanes = std::min<size_t>(4, groupEnd - r * 4);
+                    for (size_t lane = 0; lane < lanes; ++lane) {
+                        int32_t word = _mm_cvtsi128_si32(value);
+                        std::memcpy(output + (r * 4 + lane) * stride, &word, 4);
+                        value = _mm_srli_si128(value, 4);
+                    }
+                }
+            }
+            previous = static_cast<uint32_t>(_mm_cvtsi128_si32(carry));
+        }
+#endif
+    };
+}
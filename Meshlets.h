@@ -0,0 +1,343 @@
+#pragma once
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Simplifier.h"
+
+namespace IMPT {
+
+    //Meshlet Struct Describes a Small Cluster of Triangles, a Contiguous Range of the Mesh Indices, and the Bounds it is Culled by
+    struct Meshlet {
+        uint32_t indexOffset;
+        uint32_t indexCount;
+        uint32_t vertexCount;
+
+        //Bounding Sphere of the Cluster
+        glm::vec3 center;
+        float radius;
+
+        //Every Outward Triangle Normal of the Cluster is within the Cone around the Axis whose Half Angle has this Cosine,
+        //a Cutoff of Zero or Less Means the Cluster can't be Culled by Facing
+        glm::vec3 coneAxis;
+        float coneCutoff;
+    };
+
+    class MeshletBuilder {
+    public:
+
+        //Limits of a Cluster, Matching what Mesh Shading Hardware Handles Well
+        static constexpr size_t MAX_VERTICES = 64;
+        static constexpr size_t MAX_TRIANGLES = 124;
+
+        //How much a Candidate Triangle is Penalized for Turning Away from the Cluster, against how Far it Lies from it
+        static constexpr float CONE_WEIGHT = 0.5f;
+
+        /**
+         * @brief Build - Splits a Range of a Triangle List into Clusters, Reordering the Range so each Cluster is Contiguous
+         *
+         * Clusters are Grown Greedily over Shared Edges, Preferring Triangles that Add the Fewest New Vertices, then
+         * those Closest to the Cluster and Facing its Way, so Clusters Stay Compact and their Normal Cones Narrow.
+         * Normal Cones are Only Kept when the Range is a Closed Surface, where Triangles Facing Away are Always Hidden.
+         *
+         * @param Positions : The Position of each Vertex
+         * @param PositionIds : The Welded Position Id of each Vertex, from WeldPositions
+         * @param Indices : The Triangle List, whose Range is Reordered in Place
+         * @param IndexOffset : The Start of the Range
+         * @param IndexCount : The Number of Indices in the Range
+         * @return : The Clusters, in the Order they now Appear in the Range
+         */
+        static std::vector<Meshlet> Build(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& positionIds, std::vector<uint32_t>& indices, size_t indexOffset, size_t indexCount) {
+            std::vector<Meshlet> meshlets;
+            size_t triangleCount = indexCount / 3;
+            if (triangleCount == 0)
+                return meshlets;
+
+            std::vector<uint32_t> source(indices.begin() + indexOffset, indices.begin() + indexOffset + triangleCount * 3);
+            std::vector<uint32_t> welded(source.size());
+            for (size_t i = 0; i < source.size(); ++i)
+                welded[i] = positionIds[source[i]];
+
+            //Unit Normals, and the Total Area the Expected Cluster Size is Derived from
+            std::vector<glm::vec3> normals(triangleCount);
+            std::vector<glm::vec3> centroids(triangleCount);
+            double totalArea = 0.0;
+            double signedVolume = 0.0;
+            for (size_t t = 0; t < triangleCount; ++t) {
+                glm::vec3 p0 = positions[source[t * 3]], p1 = positions[source[t * 3 + 1]], p2 = positions[source[t * 3 + 2]];
+                glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+                float length = glm::length(normal);
+                normals[t] = length > 0.0f ? normal / length : glm::vec3(0.0f);
+                centroids[t] = (p0 + p1 + p2) / 3.0f;
+                totalArea += 0.5 * length;
+                signedVolume += glm::dot(glm::dvec3(p0), glm::cross(glm::dvec3(p1), glm::dvec3(p2)));
+            }
+
+            //A Closed Surface Wound Inside Out has Negative Volume, its Outward Normals are the Reversed Ones
+            bool closed = IsClosed(welded);
+            float orientation = signedVolume < 0.0 ? -1.0f : 1.0f;
+
+            std::vector<uint32_t> adjacencyOffsets, adjacency;
+            Simplifier::BuildAdjacency(positions.size(), welded, adjacencyOffsets, adjacency);
+
+            //Triangles Still Unassigned around each Position, Seeds with Few are Picked First so no Slivers are Left Behind
+            std::vector<uint32_t> live(positions.size(), 0);
+            for (uint32_t id : welded)
+                ++live[id];
+
+            float expectedRadius = static_cast<float>(std::sqrt(totalArea * MAX_TRIANGLES / triangleCount) * 0.5);
+            if (!(expectedRadius > 0.0f))
+                expectedRadius = 1.0f;
+
+            std::vector<bool> used(triangleCount, false);
+            std::vector<uint32_t> vertexStamp(positions.size(), UINT32_MAX);
+            std::vector<uint32_t> candidateStamp(triangleCount, UINT32_MAX);
+            std::vector<uint32_t> candidates, clusterTriangles, clusterVertices;
+            size_t write = indexOffset;
+            size_t nextUnused = 0;
+
+            for (uint32_t cluster = 0; write < indexOffset + triangleCount * 3; ++cluster) {
+                //Continues from the Border of the Last Cluster, or from the First Unassigned Triangle
+                uint32_t seed = UINT32_MAX;
+                uint32_t seedLive = UINT32_MAX;
+                for (uint32_t t : candidates) {
+                    if (used[t])
+                        continue;
+                    uint32_t triangleLive = live[welded[t * 3]] + live[welded[t * 3 + 1]] + live[welded[t * 3 + 2]];
+                    if (triangleLive < seedLive) {
+                        seed = t;
+                        seedLive = triangleLive;
+                    }
+                }
+                if (seed == UINT32_MAX) {
+                    while (used[nextUnused])
+                        ++nextUnused;
+                    seed = static_cast<uint32_t>(nextUnused);
+                }
+
+                candidates.clear();
+                clusterTriangles.clear();
+                clusterVertices.clear();
+                glm::vec3 centroidSum(0.0f), normalSum(0.0f);
+
+                auto addTriangle = [&](uint32_t t) {
+                    used[t] = true;
+                    clusterTriangles.push_back(t);
+                    centroidSum += centroids[t];
+                    normalSum += normals[t];
+                    for (int corner = 0; corner < 3; ++corner) {
+                        uint32_t vertex = source[t * 3 + corner];
+                        if (vertexStamp[vertex] != cluster) {
+                            vertexStamp[vertex] = cluster;
+                            clusterVertices.push_back(vertex);
+                        }
+                        uint32_t id = welded[t * 3 + corner];
+                        --live[id];
+                        for (uint32_t k = adjacencyOffsets[id]; k < adjacencyOffsets[id + 1]; ++k) {
+                            uint32_t neighbour = adjacency[k];
+                            if (!used[neighbour] && candidateStamp[neighbour] != cluster) {
+                                candidateStamp[neighbour] = cluster;
+                                candidates.push_back(neighbour);
+                            }
+                        }
+                    }
+                };
+                addTriangle(seed);
+
+                while (clusterTriangles.size() < MAX_TRIANGLES) {
+                    glm::vec3 center = centroidSum / static_cast<float>(clusterTriangles.size());
+                    float normalLength = glm::length(normalSum);
+                    glm::vec3 axis = normalLength > 0.0f ? normalSum / normalLength : glm::vec3(0.0f);
+
+                    //Fewest New Vertices First, then the Nearest Triangle Facing most Like the Cluster
+                    uint32_t best = UINT32_MAX;
+                    size_t bestExtra = 4;
+                    float bestScore = FLT_MAX;
+                    size_t kept = 0;
+                    for (uint32_t t : candidates) {
+                        if (used[t])
+                            continue;
+                        candidates[kept++] = t;
+
+                        size_t extra = 0;
+                        for (int corner = 0; corner < 3; ++corner)
+                            extra += vertexStamp[source[t * 3 + corner]] != cluster;
+                        if (clusterVertices.size() + extra > MAX_VERTICES || extra > bestExtra)
+                            continue;
+
+                        float score = glm::length(centroids[t] - center) / expectedRadius + CONE_WEIGHT * (1.0f - glm::dot(normals[t], axis));
+                        if (extra < bestExtra || score < bestScore) {
+                            best = t;
+                            bestExtra = extra;
+                            bestScore = score;
+                        }
+                    }
+                    candidates.resize(kept);
+                    if (best == UINT32_MAX)
+                        break;
+                    addTriangle(best);
+                }
+
+                Meshlet meshlet = Bounds(positions, normals, clusterTriangles, clusterVertices, closed ? orientation : 0.0f);
+                meshlet.indexOffset = static_cast<uint32_t>(write);
+                meshlet.indexCount = static_cast<uint32_t>(clusterTriangles.size() * 3);
+                for (uint32_t t : clusterTriangles) {
+                    for (int corner = 0; corner < 3; ++corner)
+                        indices[write++] = source[t * 3 + corner];
+                }
+                meshlets.push_back(meshlet);
+            }
+            return meshlets;
+        }
+
+        /**
+         * @brief WeldPositions - Gives Vertices with Bitwise Identical Positions the same Id
+         *
+         * @param Positions : The Position of each Vertex
+         * @return : The Position Id of each Vertex
+         */
+        static std::vector<uint32_t> WeldPositions(const std::vector<glm::vec3>& positions) {
+            return Simplifier::WeldPositions(positions);
+        }
+
+    private:
+
+        /**
+         * @brief IsClosed - Checks if every Edge of a Triangle List is Shared by Exactly Two Triangles
+         *
+         * @param Welded : The Triangle List, Indexing Welded Positions so Attribute Seams don't Look like Borders
+         * @return : True for a Closed Surface
+         */
+        static bool IsClosed(const std::vector<uint32_t>& welded) {
+            std::vector<uint64_t> edges;
+            edges.reserve(welded.size());
+            for (size_t i = 0; i + 2 < welded.size(); i += 3) {
+                for (int edge = 0; edge < 3; ++edge) {
+                    uint64_t a = welded[i + edge], b = welded[i + (edge + 1) % 3];
+                    edges.push_back(a < b ? (a << 32) | b : (b << 32) | a);
+                }
+            }
+            std::sort(edges.begin(), edges.end());
+            for (size_t i = 0; i < edges.size(); i += 2) {
+                if (i + 1 >= edges.size() || edges[i] != edges[i + 1] || (i + 2 < edges.size() && edges[i + 2] == edges[i]))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Bounds - Computes the Bounding Sphere and Normal Cone of a Cluster
+         *
+         * @param Positions : The Position of each Vertex
+         * @param Normals : The Unit Normal of each Triangle, Zero for Degenerate Ones
+         * @param Triangles : The Triangles of the Cluster
+         * @param Vertices : The Distinct Vertices of the Cluster
+         * @param Orientation : 1 or -1 to Turn the Normals Outward, 0 if the Surface isn't Closed and has no Cone
+         * @return : The Meshlet, without its Index Range
+         */
+        static Meshlet Bounds(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals,
+            const std::vector<uint32_t>& triangles, const std::vector<uint32_t>& vertices, float orientation) {
+            Meshlet meshlet = {};
+            meshlet.vertexCount = static_cast<uint32_t>(vertices.size());
+
+            glm::vec3 lower(FLT_MAX), upper(-FLT_MAX);
+            for (uint32_t vertex : vertices) {
+                lower = glm::min(lower, positions[vertex]);
+                upper = glm::max(upper, positions[vertex]);
+            }
+            meshlet.center = (lower + upper) * 0.5f;
+            for (uint32_t vertex : vertices)
+                meshlet.radius = std::max(meshlet.radius, glm::length(positions[vertex] - meshlet.center));
+
+            //The Cone is Left Open when the Normals Spread over a Hemisphere or More
+            meshlet.coneCutoff = -1.0f;
+            glm::vec3 normalSum(0.0f);
+            for (uint32_t t : triangles)
+                normalSum += normals[t];
+            float length = glm::length(normalSum);
+            if (orientation == 0.0f || !(length > 0.0f))
+                return meshlet;
+
+            meshlet.coneAxis = normalSum / length * orientation;
+            float cutoff = 1.0f;
+            for (uint32_t t : triangles) {
+                if (normals[t] != glm::vec3(0.0f))
+                    cutoff = std::min(cutoff, glm::dot(normals[t] * orientation, meshlet.coneAxis));
+            }
+            meshlet.coneCutoff = cutoff;
+            return meshlet;
+        }
+    };
+
+    class MeshletCuller {
+    public:
+
+        //A Cluster is Only Culled by Facing when it Faces Away by at Least this Cosine, so Edge On Clusters are Kept
+        static constexpr float CONE_MARGIN = 1e-3f;
+
+        /**
+         * @brief MeshletCuller - Derives the View Frustum and Camera of a Model in its own Space
+         *
+         * @param ModelView : The Model View Matrix of the Model
+         * @param Projection : The Projection Matrix
+         */
+        MeshletCuller(const glm::mat4& modelView, const glm::mat4& projection) {
+            //Frustum Planes from the Rows of the Combined Matrix, Normalized so Distances are in Model Units
+            glm::mat4 clip = projection * modelView;
+            glm::vec4 rows[4];
+            for (int r = 0; r < 4; ++r)
+                rows[r] = glm::vec4(clip[0][r], clip[1][r], clip[2][r], clip[3][r]);
+            for (int axis = 0; axis < 3; ++axis) {
+                planes[axis * 2] = rows[3] + rows[axis];
+                planes[axis * 2 + 1] = rows[3] - rows[axis];
+            }
+            for (glm::vec4& plane : planes) {
+                float length = glm::length(glm::vec3(plane));
+                if (length > 0.0f)
+                    plane /= length;
+            }
+
+            //Orthographic Views Look Along one Direction, Perspective Ones from a Point
+            glm::mat4 inverse = glm::inverse(modelView);
+            orthographic = projection[2][3] == 0.0f;
+            eye = glm::vec3(inverse * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+            viewDirection = glm::normalize(glm::vec3(inverse * glm::vec4(0.0f, 0.0f, -1.0f, 0.0f)));
+        }
+
+        /**
+         * @brief IsVisible - Checks if any Triangle of a Cluster may be Seen
+         *
+         * @param Meshlet : The Cluster
+         * @return : False if the Cluster is Outside the View or all its Triangles Face Away from the Camera
+         */
+        bool IsVisible(const Meshlet& meshlet) const {
+            for (const glm::vec4& plane : planes) {
+                if (glm::dot(glm::vec3(plane), meshlet.center) + plane.w < -meshlet.radius)
+                    return false;
+            }
+            if (meshlet.coneCutoff <= 0.0f)
+                return true;
+
+            //The Least any Normal in the Cone Points Away from the Camera, over every Point of the Bounding Sphere
+            glm::vec3 toCluster = orthographic ? viewDirection : meshlet.center - eye;
+            float distance = glm::length(toCluster);
+            if (!(distance > 0.0f))
+                return true;
+            float cosAngle = glm::dot(toCluster, meshlet.coneAxis) / distance;
+            float sinAngle = std::sqrt(std::max(0.0f, 1.0f - cosAngle * cosAngle));
+            float sinCutoff = std::sqrt(std::max(0.0f, 1.0f - meshlet.coneCutoff * meshlet.coneCutoff));
+            float leastCos = cosAngle * meshlet.coneCutoff - sinAngle * sinCutoff;
+            if (orthographic)
+                return leastCos <= CONE_MARGIN;
+            return distance * leastCos <= meshlet.radius + CONE_MARGIN * distance;
+        }
+
+    private:
+        glm::vec4 planes[6];
+        glm::vec3 eye;
+        glm::vec3 viewDirection;
+        bool orthographic;
+    };
+}
@@ -0,0 +1,273 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//x86 Targets Always have SSE2 on 64 Bit
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define IMPT_MIPMAPS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace IMPT {
+
+    /**
+     * @brief Mipmaps - Builds the Mip Chain of an 8 Bit Image on the CPU
+     *
+     * Each Level is a 2x2 Box Filter of the One Above, Averaged in Linear Light: the sRGB Colour Channels are
+     * Expanded to 16 Bit Linear Values, Downsampled Level after Level at that Precision, and each Level is
+     * Encoded back to sRGB on its Own, so Rounding doesn't Build Up down the Chain and Bright Details don't
+     * Darken as they Shrink. Alpha is Averaged as it is. An Odd Row or Column at the End is Left Out.
+     *
+     * The Working Pixels Always have 4 Channels of 16 Bits, so the Box Filter Sums Two Pixels per SSE2 Load.
+     */
+    class Mipmaps {
+    public:
+
+        //Level Struct Holds the Pixels of one Mip Level, Tightly Packed with the Channels of the Source
+        struct Level {
+            int width = 0;
+            int height = 0;
+            std::vector<unsigned char> pixels;
+        };
+
+        /**
+         * @brief LevelCount - The Number of Levels of a Full Mip Chain
+         *
+         * @param Width : The Width of Level 0
+         * @param Height : The Height of Level 0
+         * @return : The Number of Levels down to 1x1, Level 0 Included
+         */
+        static int LevelCount(int width, int height) {
+            int count = 1;
+            for (int size = std::max(width, height); size > 1; size >>= 1)
+                ++count;
+            return count;
+        }
+
+        /**
+         * @brief Generate - Builds the Levels Below Level 0
+         *
+         * @param Pixels : Level 0, Tightly Packed
+         * @param Width : The Width of Level 0
+         * @param Height : The Height of Level 0
+         * @param Channels : The Number of Channels, 1 (Luminance), 2 (Luminance, Alpha), 3 (RGB) or 4 (RGBA)
+         * @return : Levels 1 to LevelCount - 1, Empty for an Unsupported Channel Count
+         */
+        static std::vector<Level> Generate(const unsigned char* pixels, int width, int height, int channels) {
+            std::vector<Level> levels;
+            if (!pixels || width <= 0 || height <= 0 || channels < 1 || channels > 4)
+                return levels;
+            levels.reserve(LevelCount(width, height) - 1);
+
+            //Level 0 is Expanded Two Rows at a Time, the Levels Below Stay Linear until the Chain is Done
+            const size_t rowSize = static_cast<size_t>(width) * channels;
+            std::vector<uint16_t> expanded(static_cast<size_t>(width) * 8);
+            std::vector<uint16_t> current, next;
+            int currentWidth = width;
+            int currentHeight = height;
+
+            while (currentWidth > 1 || currentHeight > 1) {
+                int nextWidth = std::max(1, currentWidth >> 1);
+                int nextHeight = std::max(1, currentHeight >> 1);
+                next.resize(static_cast<size_t>(nextWidth) * nextHeight * 4);
+
+                for (int y = 0; y < nextHeight; ++y) {
+                    int top = 2 * y;
+                    int bottom = std::min(top + 1, currentHeight - 1);
+                    const uint16_t* topRow;
+                    const uint16_t* bottomRow;
+                    if (levels.empty()) {
+                        Expand(pixels + top * rowSize, width, channels, expanded.data());
+                        Expand(pixels + bottom * rowSize, width, channels, expanded.data() + width * 4);
+                        topRow = expanded.data();
+                        bottomRow = expanded.data() + width * 4;
+                    }
+                    else {
+                        topRow = current.data() + static_cast<size_t>(top) * currentWidth * 4;
+                        bottomRow = current.data() + static_cast<size_t>(bottom) * currentWidth * 4;
+                    }
+                    DownsampleRows(topRow, bottomRow, currentWidth, next.data() + static_cast<size_t>(y) * nextWidth * 4);
+                }
+
+                Level level;
+                level.width = nextWidth;
+                level.height = nextHeight;
+                level.pixels.resize(static_cast<size_t>(nextWidth) * nextHeight * channels);
+                Compress(next.data(), static_cast<size_t>(nextWidth) * nextHeight, channels, level.pixels.data());
+                levels.push_back(std::move(level));
+
+                current.swap(next);
+                currentWidth = nextWidth;
+                currentHeight = nextHeight;
+            }
+            return levels;
+        }
+
+    private:
+
+        /**
+         * @brief IsAlpha - Checks if a Channel Holds Alpha rather than an sRGB Value
+         *
+         * @param Channel : The Index of the Channel
+         * @param Channels : The Number of Channels
+         * @return : True for the Last Channel of Luminance Alpha and RGBA Images
+         */
+        static constexpr bool IsAlpha(int channel, int channels) {
+            return (channels == 2 || channels == 4) && channel == channels - 1;
+        }
+
+        /**
+         * @brief LinearTable - sRGB Byte to Linear 16 Bit Value
+         *
+         * @return : The Table, Built on First Use
+         */
+        static const uint16_t* LinearTable() {
+            static const std::vector<uint16_t> table = [] {
+                std::vector<uint16_t> values(256);
+                for (int i = 0; i < 256; ++i) {
+                    double srgb = i / 255.0;
+                    double linear = srgb <= 0.04045 ? srgb / 12.92 : std::pow((srgb + 0.055) / 1.055, 2.4);
+                    values[i] = static_cast<uint16_t>(std::lround(linear * 65535.0));
+                }
+                return values;
+            }();
+            return table.data();
+        }
+
+        /**
+         * @brief SrgbTable - Linear 16 Bit Value to the Nearest sRGB Byte
+         *
+         * @return : The Table, Built on First Use
+         */
+        static const unsigned char* SrgbTable() {
+            static const std::vector<unsigned char> table = [] {
+                std::vector<unsigned char> values(65536);
+                for (int i = 0; i < 65536; ++i) {
+                    double linear = i / 65535.0;
+                    double srgb = linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+                    values[i] = static_cast<unsigned char>(std::lround(std::clamp(srgb, 0.0, 1.0) * 255.0));
+                }
+                return values;
+            }();
+            return table.data();
+        }
+
+        /**
+         * @brief Expand - Converts a Row of 8 Bit Pixels to 4 Channel Linear 16 Bit Pixels
+         *
+         * @param Row : The Source Row
+         * @param Width : The Number of Pixels
+         * @param Channels : The Number of Channels of the Source
+         * @param Expanded : Receives the Linear Pixels, Unused Channels are Zero
+         * @return : Void
+         */
+        static void Expand(const unsigned char* row, int width, int channels, uint16_t* expanded) {
+            switch (channels) {
+            case 1: ExpandPixels<1>(row, width, expanded); break;
+            case 2: ExpandPixels<2>(row, width, expanded); break;
+            case 3: ExpandPixels<3>(row, width, expanded); break;
+            default: ExpandPixels<4>(row, width, expanded); break;
+            }
+        }
+
+        /**
+         * @brief ExpandPixels - Expand for a Known Channel Count, so the Channel Loop Unrolls
+         */
+        template <int Channels>
+        static void ExpandPixels(const unsigned char* row, int width, uint16_t* expanded) {
+            const uint16_t* linear = LinearTable();
+            for (int x = 0; x < width; ++x) {
+                for (int c = 0; c < 4; ++c) {
+                    uint16_t value = 0;
+                    if (c < Channels)
+                        value = IsAlpha(c, Channels) ? static_cast<uint16_t>(row[c] * 257) : linear[row[c]];
+                    expanded[c] = value;
+                }
+                row += Channels;
+                expanded += 4;
+            }
+        }
+
+        /**
+         * @brief Compress - Converts 4 Channel Linear 16 Bit Pixels back to 8 Bit Pixels
+         *
+         * @param Expanded : The Linear Pixels
+         * @param PixelCount : The Number of Pixels
+         * @param Channels : The Number of Channels of the Result
+         * @param Pixels : Receives the Pixels
+         * @return : Void
+         */
+        static void Compress(const uint16_t* expanded, size_t pixelCount, int channels, unsigned char* pixels) {
+            switch (channels) {
+            case 1: CompressPixels<1>(expanded, pixelCount, pixels); break;
+            case 2: CompressPixels<2>(expanded, pixelCount, pixels); break;
+            case 3: CompressPixels<3>(expanded, pixelCount, pixels); break;
+            default: CompressPixels<4>(expanded, pixelCount, pixels); break;
+            }
+        }
+
+        /**
+         * @brief CompressPixels - Compress for a Known Channel Count, so the Channel Loop Unrolls
+         */
+        template <int Channels>
+        static void CompressPixels(const uint16_t* expanded, size_t pixelCount, unsigned char* pixels) {
+            const unsigned char* srgb = SrgbTable();
+            for (size_t i = 0; i < pixelCount; ++i) {
+                for (int c = 0; c < Channels; ++c)
+                    pixels[c] = IsAlpha(c, Channels) ? static_cast<unsigned char>((expanded[c] + 128) / 257) : srgb[expanded[c]];
+                expanded += 4;
+                pixels += Channels;
+            }
+        }
+
+        /**
+         * @brief DownsampleRows - Averages each 2x2 Block of Two Rows of Linear Pixels
+         *
+         * @param Top : The Upper Row
+         * @param Bottom : The Lower Row, the Same as the Upper One at the Bottom of an Odd Height
+         * @param Width : The Number of Pixels of the Rows
+         * @param Result : Receives max(1, Width / 2) Pixels
+         * @return : Void
+         */
+        static void DownsampleRows(const uint16_t* top, const uint16_t* bottom, int width, uint16_t* result) {
+            //A Single Column Averages Vertically Only
+            if (width == 1) {
+                for (int c = 0; c < 4; ++c)
+                    result[c] = static_cast<uint16_t>((top[c] + bottom[c] + 1) >> 1);
+                return;
+            }
+
+            int resultWidth = width >> 1;
+            int x = 0;
+#if IMPT_MIPMAPS_SSE2
+            //Two Result Pixels per Step, the Sums Need 18 Bits so they are Widened to 32
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i rounding = _mm_set1_epi32(2);
+            const __m128i signFlip32 = _mm_set1_epi32(32768);
+            const __m128i signFlip16 = _mm_set1_epi16(static_cast<short>(0x8000));
+            for (; x + 2 <= resultWidth; x += 2) {
+                __m128i sums[2];
+                for (int p = 0; p < 2; ++p) {
+                    __m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + (x + p) * 8));
+                    __m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + (x + p) * 8));
+                    __m128i sum = _mm_add_epi32(_mm_unpacklo_epi16(upper, zero), _mm_unpackhi_epi16(upper, zero));
+                    sum = _mm_add_epi32(sum, _mm_add_epi32(_mm_unpacklo_epi16(lower, zero), _mm_unpackhi_epi16(lower, zero)));
+                    sums[p] = _mm_sub_epi32(_mm_srli_epi32(_mm_add_epi32(sum, rounding), 2), signFlip32);
+                }
+                //SSE2 only Packs with Signed Saturation, so the Values are Shifted into the Signed Range and Back
+                __m128i packed = _mm_xor_si128(_mm_packs_epi32(sums[0], sums[1]), signFlip16);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(result + x * 4), packed);
+            }
+#endif
+            for (; x < resultWidth; ++x) {
+                for (int c = 0; c < 4; ++c) {
+                    uint32_t sum = top[x * 8 + c] + top[x * 8 + 4 + c] + bottom[x * 8 + c] + bottom[x * 8 + 4 + c];
+                    result[x * 4 + c] = static_cast<uint16_t>((sum + 2) >> 2);
+                }
+            }
+        }
+    };
+}
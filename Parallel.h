@@ -0,0 +1,197 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace IMPT {
+
+    /**
+     * @brief TaskPool - A Pool of Worker Threads that ParallelFor Hands its Jobs to when Called from one of its Tasks
+     *
+     * Work Nested in a Task then Runs on the Workers the Pool Already Has instead of on New Threads, so a Pool
+     * that Keeps every Core Busy isn't Oversubscribed, and its Idle Workers still Help with a Single Large Job.
+     * A Pool Marks the Threads Running its Tasks with a TaskScope.
+     */
+    class TaskPool {
+    public:
+        virtual ~TaskPool() = default;
+
+        /**
+         * @brief ThreadCount - The Number of Threads the Tasks of the Pool Run on
+         *
+         * @return : The Number of Threads, at Least One
+         */
+        virtual size_t ThreadCount() const = 0;
+
+        /**
+         * @brief Run - Queues a Task, Safe to Call from any Thread and from Tasks
+         *
+         * @param Task : The Task Run on a Worker Thread
+         * @return : Void
+         */
+        virtual void Run(std::function<void()> task) = 0;
+
+        /**
+         * @brief Current - The Pool whose Task the Calling Thread is Running
+         *
+         * @return : The Pool, Null Outside a Task
+         */
+        static TaskPool*& Current() {
+            static thread_local TaskPool* current = nullptr;
+            return current;
+        }
+    };
+
+    //Task Scope Marks the Calling Thread as Running a Task of a Pool for as long as it Lives
+    class TaskScope {
+    public:
+        explicit TaskScope(TaskPool* pool) : previous(TaskPool::Current()) {
+            TaskPool::Current() = pool;
+        }
+
+        ~TaskScope() {
+            TaskPool::Current() = previous;
+        }
+
+        TaskScope(const TaskScope&) = delete;
+        TaskScope& operator=(const TaskScope&) = delete;
+
+    private:
+        TaskPool* previous;
+    };
+
+    /**
+     * @brief DefaultThreadCount - The Number of Workers to use when None is Requested
+     *
+     * @return : The Number of Threads of the Pool Running the Calling Task, otherwise the Number of Hardware Threads, at Least One
+     */
+    inline size_t DefaultThreadCount() {
+        if (TaskPool* pool = TaskPool::Current())
+            return pool->ThreadCount();
+        return std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief ParallelFor - Runs a Job for Every Index in [0, Count) across a Pool of Worker Threads
+     *
+     * Indices are handed out one at a time so Uneven Jobs Balance themselves. The Calling
+     * Thread Works too, and the First Exception Thrown by a Job is Rethrown once all Workers Finish.
+     * Called from a Task of a TaskPool, the Other Workers are Tasks Queued on that Pool instead of New Threads.
+     *
+     * @param Count : The Number of Jobs
+     * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count)
+     * @param Job : The Function Called with each Index
+     * @return : Void
+     */
+    template <typename Function>
+    void ParallelForOnPool(TaskPool& pool, size_t count, size_t threadCount, Function& job);
+
+    template <typename Function>
+    void ParallelFor(size_t count, size_t threadCount, Function&& job) {
+        if (threadCount == 0)
+            threadCount = DefaultThreadCount();
+        threadCount = std::min(threadCount, count);
+
+        //Nothing to Gain from Spawning Threads
+        if (threadCount <= 1) {
+            for (size_t i = 0; i < count; ++i)
+                job(i);
+            return;
+        }
+
+        if (TaskPool* pool = TaskPool::Current()) {
+            ParallelForOnPool(*pool, count, threadCount, job);
+            return;
+        }
+
+        std::atomic<size_t> nextIndex(0);
+        std::exception_ptr firstError;
+        std::mutex errorMutex;
+
+        auto worker = [&]() {
+            for (size_t i = nextIndex++; i < count; i = nextIndex++) {
+                try {
+                    job(i);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!firstError)
+                        firstError = std::current_exception();
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount - 1);
+        for (size_t i = 1; i < threadCount; ++i)
+            workers.emplace_back(worker);
+        worker();
+
+        for (std::thread& thread : workers)
+            thread.join();
+
+        if (firstError)
+            std::rethrow_exception(firstError);
+    }
+
+    /**
+     * @brief ParallelForOnPool - Runs a Job for Every Index in [0, Count) on the Calling Task and Helper Tasks of its Pool
+     *
+     * The Calling Thread Takes Indices like the Helpers, so the Jobs Finish even when every Worker is Busy, and it
+     * then only Waits for Indices a Helper has Started. A Helper that Runs once every Index is Taken Leaves without
+     * Touching the Job, so it may Outlive the Call.
+     *
+     * @param Pool : The Pool Running the Calling Task
+     * @param Count : The Number of Jobs
+     * @param ThreadCount : The Number of Threads to Use, Including the Calling One
+     * @param Job : The Function Called with each Index
+     * @return : Void
+     */
+    template <typename Function>
+    void ParallelForOnPool(TaskPool& pool, size_t count, size_t threadCount, Function& job) {
+        struct Progress {
+            std::atomic<size_t> nextIndex{ 0 };
+            std::mutex mutex;
+            std::condition_variable finished;
+            size_t finishedCount = 0;
+            std::exception_ptr firstError;
+        };
+        std::shared_ptr<Progress> progress = std::make_shared<Progress>();
+
+        auto worker = [progress, count, &job]() {
+            size_t ranCount = 0;
+            for (size_t i = progress->nextIndex++; i < count; i = progress->nextIndex++, ++ranCount) {
+                try {
+                    job(i);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(progress->mutex);
+                    if (!progress->firstError)
+                        progress->firstError = std::current_exception();
+                }
+            }
+            if (ranCount == 0)
+                return;
+            std::lock_guard<std::mutex> lock(progress->mutex);
+            progress->finishedCount += ranCount;
+            if (progress->finishedCount == count)
+                progress->finished.notify_all();
+        };
+
+        for (size_t i = 1; i < threadCount; ++i)
+            pool.Run(worker);
+        worker();
+
+        std::unique_lock<std::mutex> lock(progress->mutex);
+        progress->finished.wait(lock, [&]() { return progress->finishedCount == count; });
+        if (progress->firstError)
+            std::rethrow_exception(progress->firstError);
+    }
+}
@@ -0,0 +1,314 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace IMPT {
+    class Simplifier {
+    public:
+
+        /**
+         * @brief Simplify - Reduces a Triangle List with Quadric Error Edge Collapses
+         *
+         * Vertices are Collapsed onto Neighbouring Vertices, so the Result Indexes the same Vertex Array and
+         * can Share its Buffer. Vertices on Attribute Seams (Positions Shared by Several Vertices) and on
+         * Open Borders are Locked, so Texture Seams and Silhouettes of Open Meshes Stay Intact.
+         *
+         * @param Positions : The Position of each Vertex
+         * @param Indices : The Triangle List to Simplify
+         * @param TargetIndexCount : The Number of Indices to Reduce to
+         * @param MaxError : The Largest Geometric Error a Collapse may Introduce
+         * @param ResultError : Receives the Largest Geometric Error Introduced, if not Null
+         * @return : The Simplified Triangle List
+         */
+        static std::vector<uint32_t> Simplify(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, size_t targetIndexCount, float maxError, float* resultError = nullptr) {
+            std::vector<uint32_t> result(indices);
+            if (resultError)
+                *resultError = 0.0f;
+            if (result.size() <= targetIndexCount || positions.empty())
+                return result;
+
+            //Vertices that Share a Position Share a Quadric and are Collapsed Together
+            std::vector<uint32_t> positionIds = WeldPositions(positions);
+            std::vector<bool> locked = FindLockedVertices(positions.size(), positionIds, result);
+
+            //Every Triangle Adds its Plane to the Quadrics of its Corners
+            std::vector<Quadric> quadrics(positions.size());
+            for (size_t i = 0; i + 2 < result.size(); i += 3) {
+                glm::dvec3 p0(positions[result[i]]), p1(positions[result[i + 1]]), p2(positions[result[i + 2]]);
+                glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+                double length = glm::length(normal);
+                if (length <= 0.0)
+                    continue;
+                normal /= length;
+                Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, p0));
+                for (int corner = 0; corner < 3; ++corner)
+                    quadrics[positionIds[result[i + corner]]].Add(plane);
+            }
+
+            double maxCost = static_cast<double>(maxError) * maxError;
+            double largestCost = 0.0;
+            std::vector<uint32_t> remap(positions.size());
+            std::vector<bool> touched(positions.size());
+            std::vector<Collapse> collapses;
+            std::vector<uint32_t> adjacencyOffsets, adjacency;
+
+            //Each Pass Collapses the Cheapest Independent Edges, then Compacts the Triangle List
+            while (result.size() > targetIndexCount) {
+                size_t triangleCount = result.size() / 3;
+                BuildAdjacency(positions.size(), result, adjacencyOffsets, adjacency);
+
+                collapses.clear();
+                for (size_t i = 0; i < result.size(); i += 3) {
+                    for (int edge = 0; edge < 3; ++edge) {
+                        uint32_t a = result[i + edge], b = result[i + (edge + 1) % 3];
+                        if (!locked[a])
+                            collapses.push_back({ a, b, CollapseCost(quadrics, positionIds, positions, a, b) });
+                        if (!locked[b])
+                            collapses.push_back({ b, a, CollapseCost(quadrics, positionIds, positions, b, a) });
+                    }
+                }
+                std::sort(collapses.begin(), collapses.end(), [](const Collapse& x, const Collapse& y) {
+                    return x.cost < y.cost || (x.cost == y.cost && (x.from < y.from || (x.from == y.from && x.to < y.to)));
+                });
+
+                for (size_t v = 0; v < remap.size(); ++v)
+                    remap[v] = static_cast<uint32_t>(v);
+                std::fill(touched.begin(), touched.end(), false);
+
+                size_t collapsed = 0;
+                size_t remainingTriangles = triangleCount;
+                size_t targetTriangles = targetIndexCount / 3;
+                for (const Collapse& collapse : collapses) {
+                    if (remainingTriangles <= targetTriangles || collapse.cost > maxCost)
+                        break;
+                    if (touched[collapse.from] || touched[collapse.to])
+                        continue;
+                    if (FlipsTriangle(positions, result, adjacencyOffsets, adjacency, collapse.from, collapse.to))
+                        continue;
+
+                    //Locks the Whole Neighbourhood, so Every Collapse of this Pass Sees Valid Adjacency
+                    size_t removed = 0;
+                    for (uint32_t k = adjacencyOffsets[collapse.from]; k < adjacencyOffsets[collapse.from + 1]; ++k) {
+                        uint32_t triangle = adjacency[k];
+                        bool hasTarget = false;
+                        for (int corner = 0; corner < 3; ++corner) {
+                            uint32_t vertex = result[triangle * 3 + corner];
+                            touched[vertex] = true;
+                            hasTarget = hasTarget || vertex == collapse.to;
+                        }
+                        removed += hasTarget ? 1 : 0;
+                    }
+
+                    remap[collapse.from] = collapse.to;
+                    quadrics[positionIds[collapse.to]].Add(quadrics[positionIds[collapse.from]]);
+                    largestCost = std::max(largestCost, collapse.cost);
+                    remainingTriangles -= removed;
+                    ++collapsed;
+                }
+
+                if (collapsed == 0)
+                    break;
+
+                //Applies the Collapses and Drops the Triangles that Became Degenerate
+                size_t write = 0;
+                for (size_t i = 0; i < result.size(); i += 3) {
+                    uint32_t a = remap[result[i]], b = remap[result[i + 1]], c = remap[result[i + 2]];
+                    if (a == b || b == c || a == c)
+                        continue;
+                    result[write++] = a;
+                    result[write++] = b;
+                    result[write++] = c;
+                }
+                result.resize(write);
+            }
+
+            if (resultError)
+                *resultError = static_cast<float>(std::sqrt(largestCost));
+            return result;
+        }
+
+    private:
+        friend class MeshletBuilder;
+
+        //Quadric Struct Stores the Symmetric 4x4 Matrix of a Sum of Squared Plane Distances
+        struct Quadric {
+            double a00 = 0, a01 = 0, a02 = 0, a03 = 0, a11 = 0, a12 = 0, a13 = 0, a22 = 0, a23 = 0, a33 = 0;
+
+            static Quadric FromPlane(const glm::dvec3& n, double d) {
+                Quadric q;
+                q.a00 = n.x * n.x; q.a01 = n.x * n.y; q.a02 = n.x * n.z; q.a03 = n.x * d;
+                q.a11 = n.y * n.y; q.a12 = n.y * n.z; q.a13 = n.y * d;
+                q.a22 = n.z * n.z; q.a23 = n.z * d;
+                q.a33 = d * d;
+                return q;
+            }
+
+            void Add(const Quadric& q) {
+                a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+                a11 += q.a11; a12 += q.a12; a13 += q.a13;
+                a22 += q.a22; a23 += q.a23;
+                a33 += q.a33;
+            }
+
+            double Evaluate(const glm::dvec3& p) const {
+                double result = a00 * p.x * p.x + 2 * a01 * p.x * p.y + 2 * a02 * p.x * p.z + 2 * a03 * p.x
+                    + a11 * p.y * p.y + 2 * a12 * p.y * p.z + 2 * a13 * p.y
+                    + a22 * p.z * p.z + 2 * a23 * p.z
+                    + a33;
+                return std::max(result, 0.0);
+            }
+        };
+
+        //Collapse Struct Describes Moving one Vertex onto a Neighbour
+        struct Collapse {
+            uint32_t from;
+            uint32_t to;
+            double cost;
+        };
+
+        static double CollapseCost(const std::vector<Quadric>& quadrics, const std::vector<uint32_t>& positionIds, const std::vector<glm::vec3>& positions, uint32_t from, uint32_t to) {
+            Quadric combined = quadrics[positionIds[from]];
+            combined.Add(quadrics[positionIds[to]]);
+            return combined.Evaluate(glm::dvec3(positions[to]));
+        }
+
+        /**
+         * @brief WeldPositions - Gives Vertices with Bitwise Identical Positions the same Id
+         *
+         * @param Positions : The Position of each Vertex
+         * @return : The Position Id of each Vertex, the Index of the First Vertex with that Position
+         */
+        static std::vector<uint32_t> WeldPositions(const std::vector<glm::vec3>& positions) {
+            auto hash = [](const glm::vec3& position) {
+                uint32_t x, y, z;
+                std::memcpy(&x, &position.x, sizeof(float));
+                std::memcpy(&y, &position.y, sizeof(float));
+                std::memcpy(&z, &position.z, sizeof(float));
+                uint64_t mixed = (static_cast<uint64_t>(x) * 73856093u) ^ (static_cast<uint64_t>(y) * 19349663u) ^ (static_cast<uint64_t>(z) * 83492791u);
+                return static_cast<size_t>(mixed ^ (mixed >> 32));
+            };
+            auto same = [](const glm::vec3& a, const glm::vec3& b) {
+                return std::memcmp(&a, &b, sizeof(glm::vec3)) == 0;
+            };
+
+            //Open Addressing over a Flat Table at most Half Full, each Slot Holding the First Vertex of a Position
+            const uint32_t EMPTY = UINT32_MAX;
+            size_t slotCount = 16;
+            while (slotCount < positions.size() * 2)
+                slotCount *= 2;
+            size_t mask = slotCount - 1;
+            std::vector<uint32_t> slots(slotCount, EMPTY);
+
+            std::vector<uint32_t> positionIds(positions.size());
+            for (size_t v = 0; v < positions.size(); ++v) {
+                size_t slot = hash(positions[v]) & mask;
+                while (slots[slot] != EMPTY && !same(positions[slots[slot]], positions[v]))
+                    slot = (slot + 1) & mask;
+                if (slots[slot] == EMPTY)
+                    slots[slot] = static_cast<uint32_t>(v);
+                positionIds[v] = slots[slot];
+            }
+            return positionIds;
+        }
+
+        /**
+         * @brief FindLockedVertices - Finds the Vertices that must not Move: Attribute Seams and Open Borders
+         *
+         * @param VertexCount : The Number of Vertices
+         * @param PositionIds : The Position Id of each Vertex
+         * @param Indices : The Triangle List
+         * @return : True for each Locked Vertex
+         */
+        static std::vector<bool> FindLockedVertices(size_t vertexCount, const std::vector<uint32_t>& positionIds, const std::vector<uint32_t>& indices) {
+            std::vector<uint32_t> verticesPerPosition(vertexCount, 0);
+            for (size_t v = 0; v < vertexCount; ++v)
+                ++verticesPerPosition[positionIds[v]];
+
+            //Edges are Counted on Welded Positions, so Seams don't Look like Borders
+            std::pmr::monotonic_buffer_resource arena(indices.size() * 48);
+            std::pmr::unordered_map<uint64_t, uint32_t> edgeUses(&arena);
+            edgeUses.reserve(indices.size());
+            for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+                for (int edge = 0; edge < 3; ++edge) {
+                    uint64_t a = positionIds[indices[i + edge]], b = positionIds[indices[i + (edge + 1) % 3]];
+                    ++edgeUses[a < b ? (a << 32) | b : (b << 32) | a];
+                }
+            }
+
+            std::vector<bool> lockedPositions(vertexCount, false);
+            for (size_t v = 0; v < vertexCount; ++v)
+                lockedPositions[positionIds[v]] = lockedPositions[positionIds[v]] || verticesPerPosition[positionIds[v]] > 1;
+            for (const auto& edge : edgeUses) {
+                if (edge.second != 2) {
+                    lockedPositions[static_cast<uint32_t>(edge.first >> 32)] = true;
+                    lockedPositions[static_cast<uint32_t>(edge.first & 0xFFFFFFFFu)] = true;
+                }
+            }
+
+            std::vector<bool> locked(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v)
+                locked[v] = lockedPositions[positionIds[v]];
+            return locked;
+        }
+
+        /**
+         * @brief BuildAdjacency - Lists the Triangles Around each Vertex
+         *
+         * @param VertexCount : The Number of Vertices
+         * @param Indices : The Triangle List
+         * @param Offsets : Receives where the Triangles of each Vertex Start in Adjacency
+         * @param Adjacency : Receives the Triangle Indices, Grouped by Vertex
+         * @return : Void
+         */
+        static void BuildAdjacency(size_t vertexCount, const std::vector<uint32_t>& indices, std::vector<uint32_t>& offsets, std::vector<uint32_t>& adjacency) {
+            offsets.assign(vertexCount + 1, 0);
+            for (uint32_t index : indices)
+                ++offsets[index + 1];
+            for (size_t v = 0; v < vertexCount; ++v)
+                offsets[v + 1] += offsets[v];
+
+            adjacency.resize(indices.size());
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < indices.size(); ++i)
+                adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        /**
+         * @brief FlipsTriangle - Checks if Moving a Vertex Onto Another would Fold any Surviving Triangle Over
+         *
+         * @param Positions : The Position of each Vertex
+         * @param Indices : The Triangle List
+         * @param Offsets : Where the Triangles of each Vertex Start in Adjacency
+         * @param Adjacency : The Triangles Around each Vertex
+         * @param From : The Vertex being Moved
+         * @param To : The Vertex it Moves Onto
+         * @return : True if the Collapse Must be Rejected
+         */
+        static bool FlipsTriangle(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices, const std::vector<uint32_t>& offsets, const std::vector<uint32_t>& adjacency, uint32_t from, uint32_t to) {
+            for (uint32_t k = offsets[from]; k < offsets[from + 1]; ++k) {
+                const uint32_t* triangle = &indices[adjacency[k] * 3];
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                    continue;
+
+                glm::vec3 corners[3], movedCorners[3];
+                for (int corner = 0; corner < 3; ++corner) {
+                    corners[corner] = positions[triangle[corner]];
+                    movedCorners[corner] = triangle[corner] == from ? positions[to] : corners[corner];
+                }
+                glm::vec3 normal = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+                glm::vec3 movedNormal = glm::cross(movedCorners[1] - movedCorners[0], movedCorners[2] - movedCorners[0]);
+
+                //Rejects Flips and Triangles that Turn by more than About 75 Degrees
+                if (glm::dot(normal, movedNormal) <= 0.25f * glm::length(normal) * glm::length(movedNormal))
+                    return true;
+            }
+            return false;
+        }
+    };
+}
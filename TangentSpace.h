@@ -0,0 +1,386 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Parallel.h"
+
+//x86 Targets Always have SSE2 on 64 Bit
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define IMPT_TANGENT_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace IMPT {
+
+    //Float4 is Four Floats Operated on Together, in one SSE2 Register when the Target has it
+    struct Float4 {
+#if IMPT_TANGENT_SSE2
+        __m128 v;
+
+        static Float4 Set(float a, float b, float c, float d) { return { _mm_setr_ps(a, b, c, d) }; }
+        static Float4 Splat(float a) { return { _mm_set1_ps(a) }; }
+        void Store(float* out) const { _mm_storeu_ps(out, v); }
+
+        friend Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.v, b.v) }; }
+        friend Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+        friend Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+        friend Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.v, b.v) }; }
+        friend Float4 Min(Float4 a, Float4 b) { return { _mm_min_ps(a.v, b.v) }; }
+        friend Float4 Max(Float4 a, Float4 b) { return { _mm_max_ps(a.v, b.v) }; }
+        friend Float4 Sqrt(Float4 a) { return { _mm_sqrt_ps(a.v) }; }
+
+        //One over the Square Root, from the Estimate Refined by a Newton Step, Close to Full Precision
+        friend Float4 InverseSqrt(Float4 a) {
+            __m128 estimate = _mm_rsqrt_ps(a.v);
+            __m128 refined = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), estimate), _mm_sub_ps(_mm_set1_ps(3.0f), _mm_mul_ps(_mm_mul_ps(a.v, estimate), estimate)));
+            return { refined };
+        }
+
+        //Lanes where A > B Take IfTrue, the Others IfFalse
+        friend Float4 SelectGreater(Float4 a, Float4 b, Float4 ifTrue, Float4 ifFalse) {
+            __m128 mask = _mm_cmpgt_ps(a.v, b.v);
+            return { _mm_or_ps(_mm_and_ps(mask, ifTrue.v), _mm_andnot_ps(mask, ifFalse.v)) };
+        }
+#else
+        float v[4];
+
+        static Float4 Set(float a, float b, float c, float d) { return { { a, b, c, d } }; }
+        static Float4 Splat(float a) { return { { a, a, a, a } }; }
+        void Store(float* out) const { std::copy(v, v + 4, out); }
+
+        template <typename Operation>
+        static Float4 Apply(Float4 a, Float4 b, Operation operation) {
+            return { { operation(a.v[0], b.v[0]), operation(a.v[1], b.v[1]), operation(a.v[2], b.v[2]), operation(a.v[3], b.v[3]) } };
+        }
+
+        friend Float4 operator+(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x + y; }); }
+        friend Float4 operator-(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x - y; }); }
+        friend Float4 operator*(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x * y; }); }
+        friend Float4 operator/(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x / y; }); }
+        friend Float4 Min(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return y < x ? y : x; }); }
+        friend Float4 Max(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return y > x ? y : x; }); }
+        friend Float4 Sqrt(Float4 a) { return Apply(a, a, [](float x, float) { return std::sqrt(x); }); }
+        friend Float4 InverseSqrt(Float4 a) { return Apply(a, a, [](float x, float) { return 1.0f / std::sqrt(x); }); }
+
+        friend Float4 SelectGreater(Float4 a, Float4 b, Float4 ifTrue, Float4 ifFalse) {
+            Float4 result;
+            for (int i = 0; i < 4; ++i)
+                result.v[i] = a.v[i] > b.v[i] ? ifTrue.v[i] : ifFalse.v[i];
+            return result;
+        }
+#endif
+    };
+
+    /**
+     * @brief TangentSpace - Generates Smooth Normals and Tangents for Indexed Triangle Meshes
+     *
+     * Both Run in Two Passes: Triangles are Processed Four at a Time in Float4 Lanes, each Writing what it Adds
+     * to its Three Corners, then every Vertex Sums the Corners that Use it through an Adjacency List. The Passes
+     * Split into Chunks that Run on Worker Threads, and no two Threads Write the Same Element, so the Result
+     * doesn't Depend on the Thread Count.
+     */
+    class TangentSpace {
+    public:
+
+        //Triangles per Job, Meshes Smaller than this Stay on the Calling Thread
+        static constexpr size_t CHUNK_TRIANGLES = 16384;
+
+        /**
+         * @brief GenerateNormals - Computes Smooth Normals, each Triangle Weighted by its Angle at the Vertex
+         *
+         * Vertices with the Same Position Share a Normal, so Texture Seams don't Show in the Shading.
+         *
+         * @param Positions : The Position of each Vertex
+         * @param PositionIds : The Position Id of each Vertex, the Index of the First Vertex with that Position
+         * @param Indices : The Triangle List
+         * @param Normals : Receives the Normal of each Vertex, Zero where no Triangle with an Area Uses it
+         * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count)
+         * @return : Void
+         */
+        static void GenerateNormals(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& positionIds, const std::vector<uint32_t>& indices, std::vector<glm::vec3>& normals, size_t threadCount = 0) {
+            size_t triangleCount = indices.size() / 3;
+            //Every Corner is Written by the First Pass, so the Storage Starts Uninitialized
+            std::unique_ptr<glm::vec3[]> cornerNormals(new glm::vec3[triangleCount * 3]);
+
+            ForEachChunk(triangleCount, threadCount, [&](size_t first, size_t last) {
+                for (size_t t = first; t < last; t += 4) {
+                    Vec3x4 p[3];
+                    GatherCorners(positions, indices, t, last, p);
+
+                    Vec3x4 normal = Cross(p[1] - p[0], p[2] - p[0]);
+                    normal = normal * InverseLength(Dot(normal, normal));
+                    Float4 angles[3];
+                    CornerAngles(p, nullptr, angles);
+
+                    for (int k = 0; k < 3; ++k)
+                        Scatter(normal * angles[k], cornerNormals.get(), t, last, k);
+                }
+            });
+
+            //Every Position Sums the Corners of all its Vertices
+            std::vector<uint32_t> offsets, corners;
+            BuildAdjacency(indices, &positionIds, positions.size(), offsets, corners);
+            normals.assign(positions.size(), glm::vec3(0.0f));
+            ForEachChunk(positions.size(), threadCount, [&](size_t first, size_t last) {
+                for (size_t v = first; v < last; ++v) {
+                    if (positionIds[v] != v)
+                        continue;
+                    glm::vec3 sum(0.0f);
+                    for (uint32_t c = offsets[v]; c < offsets[v + 1]; ++c)
+                        sum += cornerNormals[corners[c]];
+                    float length = glm::length(sum);
+                    normals[v] = length > 0.0f ? sum / length : glm::vec3(0.0f);
+                }
+            });
+            ForEachChunk(positions.size(), threadCount, [&](size_t first, size_t last) {
+                for (size_t v = first; v < last; ++v)
+                    normals[v] = normals[positionIds[v]];
+            });
+        }
+
+        /**
+         * @brief GenerateTangents - Computes Tangents the Way MikkTSpace Does
+         *
+         * Each Triangle's Texture Space Tangent is Projected onto the Plane of the Vertex Normal, Normalized
+         * and Weighted by the Triangle's Angle at the Vertex, with the Angle also Measured in that Plane. The
+         * Sign of W Tells whether the Bitangent is Cross(Normal, Tangent) or its Opposite, for Mirrored UVs.
+         * Like MikkTSpace, a Vertex Shared by Mirrored and Unmirrored Triangles is Split in Two: the Vertex Keeps
+         * the Side with the Larger Angle Sum, and the Corners of the Other Side Move to a Copy of the Vertex with
+         * a Tangent of its own. Triangles without Usable UVs Stay with the Vertex.
+         *
+         * @param Positions : The Position of each Vertex
+         * @param Normals : The Unit Normal of each Vertex
+         * @param Texcoords : The Texture Coordinates of each Vertex
+         * @param Indices : The Triangle List, whose Corners on the Other Side of a Split Vertex are Moved to its Copy
+         * @param Tangents : Receives the Tangent of each Vertex, then of each Copy, in XYZ, and the Bitangent Sign in W
+         * @param SplitVertices : Receives the Vertex each Copy was Made from, the Copies are Numbered from the Vertex Count On
+         * @param ThreadCount : The Maximum Number of Threads to Use (0 Uses the Hardware Thread Count)
+         * @return : Void
+         */
+        static void GenerateTangents(const std::vector<glm::vec3>& positions, const std::vector<glm::vec3>& normals, const std::vector<glm::vec2>& texcoords, std::vector<uint32_t>& indices,
+            std::vector<glm::vec4>& tangents, std::vector<uint32_t>& splitVertices, size_t threadCount = 0) {
+            size_t triangleCount = indices.size() / 3;
+            std::unique_ptr<glm::vec4[]> cornerTangents(new glm::vec4[triangleCount * 3]);
+
+            ForEachChunk(triangleCount, threadCount, [&](size_t first, size_t last) {
+                const Float4 zero = Float4::Splat(0.0f), one = Float4::Splat(1.0f);
+                for (size_t t = first; t < last; t += 4) {
+                    Vec3x4 p[3], n[3];
+                    Float4 u[3], w[3];
+                    GatherCorners(positions, indices, t, last, p);
+                    GatherCorners(normals, indices, t, last, n);
+                    GatherTexcoords(texcoords, indices, t, last, u, w);
+
+                    //The Direction of Increasing U, Flipped where the UVs are Mirrored so it Keeps Pointing Along U
+                    Vec3x4 d1 = p[1] - p[0], d2 = p[2] - p[0];
+                    Float4 t21x = u[1] - u[0], t21y = w[1] - w[0], t31x = u[2] - u[0], t31y = w[2] - w[0];
+                    Float4 signedArea = t21x * t31y - t21y * t31x;
+                    Float4 orientation = SelectGreater(signedArea, zero, one, zero - one);
+                    Vec3x4 faceTangent = d1 * t31y - d2 * t21y;
+                    Float4 scale = orientation * InverseLength(Dot(faceTangent, faceTangent));
+                    scale = SelectGreater(signedArea * signedArea, zero, scale, zero);
+                    faceTangent = faceTangent * scale;
+
+                    //Triangles without Usable UVs Belong to Neither Side
+                    orientation = SelectGreater(signedArea * signedArea, zero, orientation, zero);
+
+                    Float4 angles[3];
+                    CornerAngles(p, n, angles);
+                    for (int k = 0; k < 3; ++k) {
+                        Vec3x4 projected = faceTangent - n[k] * Dot(n[k], faceTangent);
+                        projected = projected * InverseLength(Dot(projected, projected));
+                        Scatter(projected * angles[k], orientation * angles[k], cornerTangents.get(), t, last, k);
+                    }
+                }
+            });
+
+            //Each Vertex Sums its Unmirrored and its Mirrored Corners Apart, and Keeps the Side with the Larger Angle Sum
+            std::vector<uint32_t> offsets, corners;
+            BuildAdjacency(indices, nullptr, positions.size(), offsets, corners);
+            tangents.assign(positions.size(), glm::vec4(0.0f));
+            std::vector<unsigned char> split(positions.size(), 0);
+            ForEachChunk(positions.size(), threadCount, [&](size_t first, size_t last) {
+                for (size_t v = first; v < last; ++v) {
+                    glm::vec4 sides[2] = { glm::vec4(0.0f), glm::vec4(0.0f) };
+                    for (uint32_t c = offsets[v]; c < offsets[v + 1]; ++c) {
+                        const glm::vec4& corner = cornerTangents[corners[c]];
+                        sides[corner.w < 0.0f ? 1 : 0] += corner;
+                    }
+                    bool mirrored = -sides[1].w > sides[0].w;
+                    tangents[v] = FinishTangent(sides[mirrored ? 1 : 0], normals[v], mirrored);
+                    split[v] = sides[0].w > 0.0f && sides[1].w < 0.0f;
+                }
+            });
+
+            //The Copies are Made in Vertex Order, so the Result doesn't Depend on the Thread Count
+            splitVertices.clear();
+            for (size_t v = 0; v < positions.size(); ++v) {
+                if (!split[v])
+                    continue;
+                bool mirrored = tangents[v].w > 0.0f;
+                uint32_t copy = static_cast<uint32_t>(positions.size() + splitVertices.size());
+                glm::vec4 sum(0.0f);
+                for (uint32_t c = offsets[v]; c < offsets[v + 1]; ++c) {
+                    const glm::vec4& corner = cornerTangents[corners[c]];
+                    if (mirrored ? corner.w < 0.0f : corner.w > 0.0f) {
+                        sum += corner;
+                        indices[corners[c]] = copy;
+                    }
+                }
+                splitVertices.push_back(static_cast<uint32_t>(v));
+                tangents.push_back(FinishTangent(sum, normals[v], mirrored));
+            }
+        }
+
+    private:
+
+        struct Vec3x4 {
+            Float4 x, y, z;
+
+            friend Vec3x4 operator+(const Vec3x4& a, const Vec3x4& b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+            friend Vec3x4 operator-(const Vec3x4& a, const Vec3x4& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+            friend Vec3x4 operator*(const Vec3x4& a, Float4 s) { return { a.x * s, a.y * s, a.z * s }; }
+        };
+
+        static Float4 Dot(const Vec3x4& a, const Vec3x4& b) {
+            return a.x * b.x + a.y * b.y + a.z * b.z;
+        }
+
+        static Vec3x4 Cross(const Vec3x4& a, const Vec3x4& b) {
+            return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+        }
+
+        //One over the Square Root of each Lane, Zero where the Lane is Zero, so Degenerate Vectors Stay Zero when Normalized
+        static Float4 InverseLength(Float4 squaredLength) {
+            Float4 zero = Float4::Splat(0.0f);
+            return SelectGreater(squaredLength, Float4::Splat(1e-30f), InverseSqrt(Max(squaredLength, Float4::Splat(1e-30f))), zero);
+        }
+
+        //Arc Cosine from Abramowitz and Stegun 4.4.45, within 7e-5 Radians, Plenty for a Weight
+        static Float4 Acos(Float4 x) {
+            Float4 zero = Float4::Splat(0.0f);
+            x = Min(Max(x, Float4::Splat(-1.0f)), Float4::Splat(1.0f));
+            Float4 absolute = Max(x, zero - x);
+            Float4 polynomial = ((Float4::Splat(-0.0187293f) * absolute + Float4::Splat(0.0742610f)) * absolute + Float4::Splat(-0.2121144f)) * absolute + Float4::Splat(1.5707288f);
+            Float4 result = Sqrt(Float4::Splat(1.0f) - absolute) * polynomial;
+            return SelectGreater(zero, x, Float4::Splat(3.14159265f) - result, result);
+        }
+
+        /**
+         * @brief CornerAngles - The Angle of each Corner of Four Triangles
+         *
+         * @param P : The Corner Positions
+         * @param N : If not Null, the Corner Normals, the Edges are then Projected onto their Planes First
+         * @param Angles : Receives the Angles
+         * @return : Void
+         */
+        static void CornerAngles(const Vec3x4* p, const Vec3x4* n, Float4* angles) {
+            for (int k = 0; k < 3; ++k) {
+                Vec3x4 a = p[(k + 1) % 3] - p[k], b = p[(k + 2) % 3] - p[k];
+                if (n) {
+                    a = a - n[k] * Dot(n[k], a);
+                    b = b - n[k] * Dot(n[k], b);
+                }
+                angles[k] = Acos(Dot(a, b) * InverseLength(Dot(a, a) * Dot(b, b)));
+            }
+        }
+
+        //Lanes Past the Last Triangle Repeat it, their Results are Dropped by Scatter
+        static size_t Lane(size_t t, size_t lane, size_t last) {
+            return std::min(t + lane, last - 1);
+        }
+
+        static void GatherCorners(const std::vector<glm::vec3>& values, const std::vector<uint32_t>& indices, size_t t, size_t last, Vec3x4* corners) {
+            for (int k = 0; k < 3; ++k) {
+                const glm::vec3& a = values[indices[Lane(t, 0, last) * 3 + k]];
+                const glm::vec3& b = values[indices[Lane(t, 1, last) * 3 + k]];
+                const glm::vec3& c = values[indices[Lane(t, 2, last) * 3 + k]];
+                const glm::vec3& d = values[indices[Lane(t, 3, last) * 3 + k]];
+                corners[k] = { Float4::Set(a.x, b.x, c.x, d.x), Float4::Set(a.y, b.y, c.y, d.y), Float4::Set(a.z, b.z, c.z, d.z) };
+            }
+        }
+
+        static void GatherTexcoords(const std::vector<glm::vec2>& values, const std::vector<uint32_t>& indices, size_t t, size_t last, Float4* u, Float4* v) {
+            for (int k = 0; k < 3; ++k) {
+                const glm::vec2& a = values[indices[Lane(t, 0, last) * 3 + k]];
+                const glm::vec2& b = values[indices[Lane(t, 1, last) * 3 + k]];
+                const glm::vec2& c = values[indices[Lane(t, 2, last) * 3 + k]];
+                const glm::vec2& d = values[indices[Lane(t, 3, last) * 3 + k]];
+                u[k] = Float4::Set(a.x, b.x, c.x, d.x);
+                v[k] = Float4::Set(a.y, b.y, c.y, d.y);
+            }
+        }
+
+        static void Scatter(const Vec3x4& value, glm::vec3* corners, size_t t, size_t last, int k) {
+            float x[4], y[4], z[4];
+            value.x.Store(x);
+            value.y.Store(y);
+            value.z.Store(z);
+            for (size_t lane = 0; lane < 4 && t + lane < last; ++lane)
+                corners[(t + lane) * 3 + k] = glm::vec3(x[lane], y[lane], z[lane]);
+        }
+
+        static void Scatter(const Vec3x4& value, Float4 w, glm::vec4* corners, size_t t, size_t last, int k) {
+            float x[4], y[4], z[4], s[4];
+            value.x.Store(x);
+            value.y.Store(y);
+            value.z.Store(z);
+            w.Store(s);
+            for (size_t lane = 0; lane < 4 && t + lane < last; ++lane)
+                corners[(t + lane) * 3 + k] = glm::vec4(x[lane], y[lane], z[lane], s[lane]);
+        }
+
+        //Vertices without Usable UVs Get any Tangent Perpendicular to the Normal
+        static glm::vec4 FinishTangent(const glm::vec4& sum, const glm::vec3& normal, bool mirrored) {
+            glm::vec3 tangent(sum);
+            float length = glm::length(tangent);
+            tangent = length > 0.0f ? tangent / length : AnyPerpendicular(normal);
+            return glm::vec4(tangent, mirrored ? -1.0f : 1.0f);
+        }
+
+        static glm::vec3 AnyPerpendicular(const glm::vec3& normal) {
+            glm::vec3 axis = std::abs(normal.x) < 0.9f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+            glm::vec3 tangent = axis - normal * glm::dot(normal, axis);
+            float length = glm::length(tangent);
+            return length > 0.0f ? tangent / length : glm::vec3(1.0f, 0.0f, 0.0f);
+        }
+
+        /**
+         * @brief BuildAdjacency - Lists the Corners that Use each Vertex, or each Position when Ids are Given
+         *
+         * @param Indices : The Triangle List
+         * @param Ids : If not Null, the Key of each Vertex, Corners are then Listed under their Vertex's Key
+         * @param VertexCount : The Number of Vertices
+         * @param Offsets : Receives where the Corners of each Key Start, with one Extra Entry for the End
+         * @param Corners : Receives the Corners, as Indices into the Triangle List
+         * @return : Void
+         */
+        static void BuildAdjacency(const std::vector<uint32_t>& indices, const std::vector<uint32_t>* ids, size_t vertexCount, std::vector<uint32_t>& offsets, std::vector<uint32_t>& corners) {
+            size_t cornerCount = indices.size() / 3 * 3;
+            auto key = [&](size_t corner) { return ids ? (*ids)[indices[corner]] : indices[corner]; };
+
+            offsets.assign(vertexCount + 1, 0);
+            for (size_t c = 0; c < cornerCount; ++c)
+                ++offsets[key(c) + 1];
+            for (size_t v = 0; v < vertexCount; ++v)
+                offsets[v + 1] += offsets[v];
+
+            corners.resize(cornerCount);
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t c = 0; c < cornerCount; ++c)
+                corners[cursor[key(c)]++] = static_cast<uint32_t>(c);
+        }
+
+        template <typename Function>
+        static void ForEachChunk(size_t count, size_t threadCount, Function&& job) {
+            size_t chunkCount = (count + CHUNK_TRIANGLES - 1) / CHUNK_TRIANGLES;
+            ParallelFor(chunkCount, threadCount, [&](size_t chunk) {
+                job(chunk * CHUNK_TRIANGLES, std::min(count, (chunk + 1) * CHUNK_TRIANGLES));
+            });
+        }
+    };
+}
@@ -0,0 +1,460 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+//x86 Targets Always have SSE2 on 64 Bit, AVX2 is Detected at Run Time
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define IMPT_SCAN_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define IMPT_TARGET_AVX2
+#else
+#define IMPT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace IMPT {
+
+    /**
+     * @brief CountTrailingZeros - The Index of the Lowest Set Bit
+     *
+     * @param Bits : The Bits, Must not be Zero
+     * @return : The Bit Index
+     */
+    inline unsigned CountTrailingZeros(uint64_t bits) {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, bits);
+        return static_cast<unsigned>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(bits));
+#else
+        unsigned index = 0;
+        while (!(bits & 1)) {
+            bits >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    /**
+     * @brief PopCount - The Number of Set Bits
+     *
+     * @param Bits : The Bits
+     * @return : The Number of Set Bits
+     */
+    inline unsigned PopCount(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(bits));
+#else
+        //POPCNT isn't Guaranteed on every x64 Processor, so MSVC Uses the Bit Trick
+        bits = bits - ((bits >> 1) & 0x5555555555555555ull);
+        bits = (bits & 0x3333333333333333ull) + ((bits >> 2) & 0x3333333333333333ull);
+        bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<unsigned>((bits * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    /**
+     * @brief ClassifyBlocksScalar - Marks the Delimiters and Line Breaks of 64 Byte Blocks, One Byte at a Time
+     *
+     * @param Data : The Blocks
+     * @param BlockCount : The Number of Blocks
+     * @param Delimiters : Receives a Bit per Byte, Set for Spaces, Tabs, Carriage Returns, Line Breaks, ...
+     * @param NewLines : Receives a Bit per Byte, Set for Line Breaks
+     * @return : Void
+     */
+    inline void ClassifyBlocksScalar(const char* data, size_t blockCount, uint64_t* delimiters, uint64_t* newLines) {
+        for (size_t block = 0; block < blockCount; ++block) {
+            uint64_t delimiterBits = 0, newLineBits = 0;
+            for (unsigned i = 0; i < 64; ++i) {
+                unsigned char character = static_cast<unsigned char>(data[block * 64 + i]);
+                if (character == ' ' || static_cast<unsigned char>(character - '\t') <= '\r' - '\t')
+                    delimiterBits |= uint64_t(1) << i;
+                if (character == '\n')
+                    newLineBits |= uint64_t(1) << i;
+            }
+            delimiters[block] = delimiterBits;
+            newLines[block] = newLineBits;
+        }
+    }
+
+#if IMPT_SCAN_X86
+    /**
+     * @brief ClassifyBlocksSse2 - Marks the Delimiters and Line Breaks of 64 Byte Blocks, 16 Bytes at a Time
+     */
+    inline void ClassifyBlocksSse2(const char* data, size_t blockCount, uint64_t* delimiters, uint64_t* newLines) {
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i controlRange = _mm_set1_epi8('\r' - '\t');
+        const __m128i newLine = _mm_set1_epi8('\n');
+
+        for (size_t block = 0; block < blockCount; ++block) {
+            uint64_t delimiterBits = 0, newLineBits = 0;
+            for (unsigned part = 0; part < 4; ++part) {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + block * 64 + part * 16));
+
+                //'\t' to '\r' are Contiguous, so One Unsigned Range Check Covers them
+                __m128i control = _mm_sub_epi8(bytes, tab);
+                __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(control, controlRange), control);
+                __m128i isDelimiter = _mm_or_si128(isControl, _mm_cmpeq_epi8(bytes, space));
+
+                delimiterBits |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(isDelimiter))) << (part * 16);
+                newLineBits |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newLine)))) << (part * 16);
+            }
+            delimiters[block] = delimiterBits;
+            newLines[block] = newLineBits;
+        }
+    }
+
+    /**
+     * @brief ClassifyBlocksAvx2 - Marks the Delimiters and Line Breaks of 64 Byte Blocks, 32 Bytes at a Time
+     */
+    IMPT_TARGET_AVX2 inline void ClassifyBlocksAvx2(const char* data, size_t blockCount, uint64_t* delimiters, uint64_t* newLines) {
+        const __m256i space = _mm256_set1_epi8(' ');
+        const __m256i tab = _mm256_set1_epi8('\t');
+        const __m256i controlRange = _mm256_set1_epi8('\r' - '\t');
+        const __m256i newLine = _mm256_set1_epi8('\n');
+
+        for (size_t block = 0; block < blockCount; ++block) {
+            uint64_t delimiterBits = 0, newLineBits = 0;
+            for (unsigned part = 0; part < 2; ++part) {
+                __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + block * 64 + part * 32));
+
+                __m256i control = _mm256_sub_epi8(bytes, tab);
+                __m256i isControl = _mm256_cmpeq_epi8(_mm256_min_epu8(control, controlRange), control);
+                __m256i isDelimiter = _mm256_or_si256(isControl, _mm256_cmpeq_epi8(bytes, space));
+
+                delimiterBits |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(isDelimiter))) << (part * 32);
+                newLineBits |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, newLine)))) << (part * 32);
+            }
+            delimiters[block] = delimiterBits;
+            newLines[block] = newLineBits;
+        }
+    }
+
+    /**
+     * @brief HasAvx2 - Checks if the Processor and the Operating System Support AVX2
+     *
+     * @return : True if AVX2 Instructions can be Used
+     */
+    inline bool HasAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+
+        //The OS must Save the YMM Registers on Context Switches
+        __cpuid(info, 1);
+        bool osSavesAvx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+
+        __cpuidex(info, 7, 0);
+        return osSavesAvx && (info[1] & (1 << 5));
+#else
+        return __builtin_cpu_supports("avx2");
+#endif
+    }
+#endif
+
+    //Classify Blocks Function is the Signature Shared by the Scalar and SIMD Classifiers
+    using ClassifyBlocksFunction = void (*)(const char*, size_t, uint64_t*, uint64_t*);
+
+    /**
+     * @brief SelectClassifier - Picks the Widest Classifier the Processor Supports, Once
+     *
+     * @return : The Classifier
+     */
+    inline ClassifyBlocksFunction SelectClassifier() {
+        static const ClassifyBlocksFunction classifier = []() -> ClassifyBlocksFunction {
+#if IMPT_SCAN_X86
+            return HasAvx2() ? ClassifyBlocksAvx2 : ClassifyBlocksSse2;
+#else
+            return ClassifyBlocksScalar;
+#endif
+        }();
+        return classifier;
+    }
+
+    //Text Scanner Splits Text into Tokens and Line Breaks with a Vectorized Pre-Pass: each Window of 64 Byte Blocks is
+    //Classified into Bit Masks, the Token Boundaries are Extracted from the Masks, and Tokens are then Read in Order
+    class TextScanner {
+    public:
+        TextScanner(const char* begin, const char* end)
+            : end(end), windowEnd(begin), classify(SelectClassifier()),
+              starts(new const char*[MAX_BOUNDARIES]), ends(new const char*[MAX_BOUNDARIES]) {}
+
+        TextScanner(const TextScanner&) = delete;
+        TextScanner& operator=(const TextScanner&) = delete;
+
+        /**
+         * @brief NextToken - Reads the Next Token of the Current Line
+         *
+         * @return : View of the Token, Empty at the End of the Line
+         */
+        std::string_view NextToken() {
+            if (!Available())
+                return std::string_view();
+
+            //Line Breaks are Kept as Tokens of their own, so Lines can't Run Together
+            if (*starts[next] == '\n')
+                return std::string_view();
+
+            std::string_view token(starts[next], static_cast<size_t>(ends[next] - starts[next]));
+            ++next;
+            return token;
+        }
+
+        /**
+         * @brief NextLine - Skips the Rest of the Current Line
+         *
+         * @return : True if there is Another Line
+         */
+        bool NextLine() {
+            while (Available()) {
+                bool lineBreak = *starts[next] == '\n';
+                ++next;
+                if (lineBreak)
+                    return Available();
+            }
+            return false;
+        }
+
+    private:
+        static constexpr size_t WINDOW_BLOCKS = 64;
+        static constexpr size_t WINDOW_SIZE = WINDOW_BLOCKS * 64;
+
+        //Every Byte of a Window can Start a Token, Plus the Token Carried from the Previous Window and the Slack Flatten Writes
+        static constexpr size_t MAX_BOUNDARIES = WINDOW_SIZE + 2 + 4;
+
+        /**
+         * @brief Available - Checks if there is a Complete Token to Read, Scanning more Text if Needed
+         */
+        bool Available() {
+            while (next == std::min(startCount, endCount)) {
+                if (windowEnd == end)
+                    return false;
+                Scan();
+            }
+            return true;
+        }
+
+        /**
+         * @brief Scan - Classifies the Next Window and Appends the Boundaries of its Tokens
+         */
+        void Scan() {
+            //Only a Token that Started in an Earlier Window and hasn't Ended Yet is Kept
+            if (startCount > endCount) {
+                starts[0] = starts[startCount - 1];
+                startCount = 1;
+            }
+            else {
+                startCount = 0;
+            }
+            endCount = 0;
+            next = 0;
+
+            const char* windowBegin = windowEnd;
+            size_t size = std::min(WINDOW_SIZE, static_cast<size_t>(end - windowBegin));
+            windowEnd = windowBegin + size;
+
+            uint64_t delimiters[WINDOW_BLOCKS], newLines[WINDOW_BLOCKS];
+            size_t fullBlocks = size / 64;
+            classify(windowBegin, fullBlocks, delimiters, newLines);
+
+            //The Last Partial Block is Padded with Spaces, which End the Last Token
+            size_t blockCount = fullBlocks;
+            if (size % 64) {
+                char padded[64];
+                std::memset(padded, ' ', sizeof(padded));
+                std::memcpy(padded, windowBegin + fullBlocks * 64, size % 64);
+                classify(padded, 1, delimiters + fullBlocks, newLines + fullBlocks);
+                ++blockCount;
+            }
+
+            for (size_t block = 0; block < blockCount; ++block) {
+                const char* base = windowBegin + block * 64;
+                uint64_t tokenBytes = ~delimiters[block];
+                uint64_t lineBreaks = newLines[block];
+
+                //A Token Starts where a Token Byte Follows a Delimiter, and Ends at the Next Delimiter,
+                //every Line Break is a One Byte Token that Ends at the Byte after it
+                uint64_t startBits = (tokenBytes & ~((tokenBytes << 1) | tokenCarry)) | lineBreaks;
+                uint64_t endBits = (~tokenBytes & ((tokenBytes << 1) | tokenCarry)) | (lineBreaks << 1) | lineBreakCarry;
+                tokenCarry = tokenBytes >> 63;
+                lineBreakCarry = lineBreaks >> 63;
+
+                Flatten(base, startBits, starts.get(), startCount);
+                Flatten(base, endBits, ends.get(), endCount);
+            }
+
+            //The Text Ended Inside a Token or Right after a Line Break
+            if (windowEnd == end) {
+                if (tokenCarry && size % 64 == 0)
+                    ends[endCount++] = end;
+                if (lineBreakCarry)
+                    ends[endCount++] = end;
+                tokenCarry = 0;
+                lineBreakCarry = 0;
+            }
+        }
+
+        /**
+         * @brief Flatten - Appends the Position of every Set Bit of a Block
+         */
+        static void Flatten(const char* base, uint64_t bits, const char** positions, size_t& count) {
+            //Writes Four Positions per Step without Checking, so Dense Blocks Take Fewer Unpredictable Branches,
+            //the Extra Writes Land Past the Count and are Overwritten Later
+            const char** output = positions + count;
+            count += PopCount(bits);
+            while (bits) {
+                output[0] = base + CountTrailingZeros(bits);
+                bits &= bits - 1;
+                output[1] = base + CountTrailingZeros(bits | (uint64_t(1) << 63));
+                bits &= bits - 1;
+                output[2] = base + CountTrailingZeros(bits | (uint64_t(1) << 63));
+                bits &= bits - 1;
+                output[3] = base + CountTrailingZeros(bits | (uint64_t(1) << 63));
+                bits &= bits - 1;
+                output += 4;
+            }
+        }
+
+        const char* end;
+        const char* windowEnd;
+        ClassifyBlocksFunction classify;
+        std::unique_ptr<const char*[]> starts;
+        std::unique_ptr<const char*[]> ends;
+        size_t startCount = 0;
+        size_t endCount = 0;
+        size_t next = 0;
+        uint64_t tokenCarry = 0;
+        uint64_t lineBreakCarry = 0;
+    };
+
+    /**
+     * @brief ParseEightDigits - Converts Eight ASCII Digits to their Value with a Few Multiplications
+     *
+     * @param Text : The Eight Characters
+     * @param Value : The Value, if they are all Digits
+     * @return : True if the Eight Characters are all Digits
+     */
+    inline bool ParseEightDigits(const char* text, uint64_t& value) {
+        uint64_t chunk;
+        std::memcpy(&chunk, text, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        chunk = __builtin_bswap64(chunk);
+#endif
+
+        //Every Byte must be Between '0' and '9', Adding 0x46 Sets the Top Bit of Bytes Above '9'
+        if (((chunk + 0x4646464646464646ull) | (chunk - 0x3030303030303030ull)) & 0x8080808080808080ull)
+            return false;
+
+        //Combines Pairs of Digits, then Pairs of Pairs, then Pairs of Quadruples
+        chunk = (chunk & 0x0F0F0F0F0F0F0F0Full) * 2561 >> 8;
+        chunk = (chunk & 0x00FF00FF00FF00FFull) * 6553601 >> 16;
+        value = (chunk & 0x0000FFFF0000FFFFull) * 42949672960001ull >> 32;
+        return true;
+    }
+
+    /**
+     * @brief ParseDecimal - Parses a Decimal Number into a Float, with the same Result and Rounding as std::from_chars
+     *
+     * Numbers whose Digits Fit an Exact Double and have a Small Exponent are Converted with a Single Exactly Rounded
+     * Double Operation, which Covers Practically every Number in Mesh Files, the Rest Fall Back to std::from_chars.
+     *
+     * @param First : The Start of the Text
+     * @param Last : The End of the Text
+     * @param Value : The Parsed Value, Unchanged if Parsing Fails
+     * @return : Pointer Past the Number and the Error Code, as std::from_chars
+     */
+    inline std::from_chars_result ParseDecimal(const char* first, const char* last, float& value) {
+        static const double POWERS_OF_TEN[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        const char* cursor = first;
+        bool negative = cursor < last && *cursor == '-';
+        if (negative)
+            ++cursor;
+
+        //Integer and Fraction Digits, Accumulated as one Integer Mantissa
+        uint64_t mantissa = 0;
+        int exponent = 0;
+        const char* integerStart = cursor;
+        while (cursor < last && static_cast<unsigned char>(*cursor - '0') <= 9) {
+            mantissa = mantissa * 10 + static_cast<unsigned>(*cursor - '0');
+            ++cursor;
+        }
+        size_t digitCount = static_cast<size_t>(cursor - integerStart);
+
+        if (cursor < last && *cursor == '.') {
+            ++cursor;
+            const char* fractionStart = cursor;
+
+            //Long Fractions are Read Eight Digits at a Time
+            uint64_t eightDigits;
+            if (last - cursor >= 8 && ParseEightDigits(cursor, eightDigits)) {
+                mantissa = mantissa * 100000000 + eightDigits;
+                cursor += 8;
+            }
+            while (cursor < last && static_cast<unsigned char>(*cursor - '0') <= 9) {
+                mantissa = mantissa * 10 + static_cast<unsigned>(*cursor - '0');
+                ++cursor;
+            }
+            exponent -= static_cast<int>(cursor - fractionStart);
+            digitCount += static_cast<size_t>(cursor - fractionStart);
+        }
+
+        //A Lone Sign or Dot, "inf", "nan", Hex Floats, Mantissas that Overflow or aren't Exact Doubles, ... are Left to std::from_chars
+        if (digitCount == 0 || digitCount > 19 || mantissa > (uint64_t(1) << 53))
+            return std::from_chars(first, last, value);
+
+        if (cursor < last && (*cursor == 'e' || *cursor == 'E')) {
+            const char* exponentCursor = cursor + 1;
+            bool negativeExponent = exponentCursor < last && *exponentCursor == '-';
+            if (exponentCursor < last && (*exponentCursor == '-' || *exponentCursor == '+'))
+                ++exponentCursor;
+
+            //An 'e' without Digits isn't Part of the Number
+            if (exponentCursor < last && static_cast<unsigned char>(*exponentCursor - '0') <= 9) {
+                int exponentValue = 0;
+                while (exponentCursor < last && static_cast<unsigned char>(*exponentCursor - '0') <= 9) {
+                    if (exponentValue < 10000)
+                        exponentValue = exponentValue * 10 + (*exponentCursor - '0');
+                    ++exponentCursor;
+                }
+                exponent += negativeExponent ? -exponentValue : exponentValue;
+                cursor = exponentCursor;
+            }
+        }
+
+        if (mantissa == 0) {
+            value = negative ? -0.0f : 0.0f;
+            return { cursor, std::errc() };
+        }
+
+        //The Mantissa and the Power of Ten are Exact Doubles, so the Product or Quotient is Correctly Rounded
+        if (exponent < -22 || exponent > 22)
+            return std::from_chars(first, last, value);
+        double result = static_cast<double>(mantissa);
+        result = exponent < 0 ? result / POWERS_OF_TEN[-exponent] : result * POWERS_OF_TEN[exponent];
+
+        //Rounding to Float Twice can only go Wrong when the Double Lands Exactly Halfway between two Floats
+        uint64_t bits;
+        std::memcpy(&bits, &result, sizeof(bits));
+        if ((bits & ((uint64_t(1) << 29) - 1)) == (uint64_t(1) << 28))
+            return std::from_chars(first, last, value);
+
+        value = static_cast<float>(negative ? -result : result);
+        return { cursor, std::errc() };
+    }
+}
@@ -0,0 +1,177 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace IMPT {
+    class VertexCacheOptimizer {
+    public:
+
+        //Entries of the Simulated Post-Transform Cache, a FIFO as on most Hardware
+        static constexpr size_t CACHE_SIZE = 16;
+
+        //Statistics Struct Holds how Often a Triangle List Misses the Post-Transform Cache
+        struct Statistics {
+            //Average Cache Miss Ratio, Transformed Vertices per Triangle (0.5 is the Ideal for Large Regular Meshes)
+            float acmr = 0.0f;
+
+            //Average Transform to Vertex Ratio, Transformed Vertices per Distinct Vertex (1 is the Ideal)
+            float atvr = 0.0f;
+        };
+
+        /**
+         * @brief Analyze - Simulates the Post-Transform Cache over a Triangle List
+         *
+         * @param Indices : The Triangle List
+         * @param IndexCount : The Number of Indices
+         * @param CacheSize : The Number of Cache Entries
+         * @return : The ACMR and ATVR of the List
+         */
+        static Statistics Analyze(const uint32_t* indices, size_t indexCount, size_t cacheSize = CACHE_SIZE) {
+            Statistics statistics;
+            if (indexCount < 3)
+                return statistics;
+
+            std::vector<uint32_t> vertices(indices, indices + indexCount);
+            std::sort(vertices.begin(), vertices.end());
+            size_t vertexCount = static_cast<size_t>(std::unique(vertices.begin(), vertices.end()) - vertices.begin());
+
+            //A Vertex is in the FIFO while Fewer than CacheSize Misses Happened since it was Loaded
+            std::vector<size_t> loadedAt(vertexCount, 0);
+            size_t misses = 0;
+            for (size_t i = 0; i < indexCount; ++i) {
+                size_t local = static_cast<size_t>(std::lower_bound(vertices.begin(), vertices.begin() + vertexCount, indices[i]) - vertices.begin());
+                if (loadedAt[local] == 0 || misses - loadedAt[local] + 1 > cacheSize)
+                    loadedAt[local] = ++misses;
+            }
+
+            statistics.acmr = static_cast<float>(misses) / static_cast<float>(indexCount / 3);
+            statistics.atvr = static_cast<float>(misses) / static_cast<float>(vertexCount);
+            return statistics;
+        }
+
+        /**
+         * @brief OptimizeTriangles - Reorders a Triangle List for the Post-Transform Cache with Tipsify
+         *
+         * Triangles are Emitted as Fans around a Focus Vertex, and the Next Focus is the Neighbour that will still
+         * be in the Cache once its own Fan is Emitted, so Vertices are Transformed about once each. Runs in Linear
+         * Time, Triangles Keep their Winding.
+         *
+         * @param Indices : The Triangle List, Reordered in Place
+         * @param IndexCount : The Number of Indices
+         * @param CacheSize : The Number of Cache Entries to Optimize for
+         * @return : Void
+         */
+        static void OptimizeTriangles(uint32_t* indices, size_t indexCount, size_t cacheSize = CACHE_SIZE) {
+            size_t triangleCount = indexCount / 3;
+            if (triangleCount < 2)
+                return;
+
+            //Works on Dense Local Vertex Ids, so Small Ranges of a Large Mesh Stay Cheap
+            std::vector<uint32_t> vertices(indices, indices + triangleCount * 3);
+            std::sort(vertices.begin(), vertices.end());
+            vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+            size_t vertexCount = vertices.size();
+            std::vector<uint32_t> local(triangleCount * 3);
+            for (size_t i = 0; i < local.size(); ++i)
+                local[i] = static_cast<uint32_t>(std::lower_bound(vertices.begin(), vertices.end(), indices[i]) - vertices.begin());
+
+            //Triangles around each Vertex
+            std::vector<uint32_t> offsets(vertexCount + 1, 0);
+            for (uint32_t vertex : local)
+                ++offsets[vertex + 1];
+            for (size_t v = 0; v < vertexCount; ++v)
+                offsets[v + 1] += offsets[v];
+            std::vector<uint32_t> adjacency(local.size());
+            std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < local.size(); ++i)
+                adjacency[cursor[local[i]]++] = static_cast<uint32_t>(i / 3);
+
+            std::vector<uint32_t> live(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v)
+                live[v] = offsets[v + 1] - offsets[v];
+
+            //Cache Time Stamps, a Vertex is Cached while the Time is Less than CacheSize Past its Stamp
+            std::vector<size_t> stamps(vertexCount, 0);
+            std::vector<bool> emitted(triangleCount, false);
+            std::vector<uint32_t> deadEnds, candidates, result;
+            result.reserve(local.size());
+            size_t time = cacheSize + 1;
+            size_t scan = 0;
+
+            for (int64_t focus = 0; focus >= 0; ) {
+                //Emits the Remaining Fan around the Focus
+                candidates.clear();
+                for (uint32_t k = offsets[focus]; k < offsets[focus + 1]; ++k) {
+                    uint32_t triangle = adjacency[k];
+                    if (emitted[triangle])
+                        continue;
+                    emitted[triangle] = true;
+                    for (int corner = 0; corner < 3; ++corner) {
+                        uint32_t vertex = local[triangle * 3 + corner];
+                        result.push_back(vertex);
+                        deadEnds.push_back(vertex);
+                        candidates.push_back(vertex);
+                        --live[vertex];
+                        if (time - stamps[vertex] > cacheSize)
+                            stamps[vertex] = time++;
+                    }
+                }
+
+                //The Next Focus is the Candidate Longest in the Cache that will Survive its own Fan
+                focus = -1;
+                size_t bestPriority = 0;
+                for (uint32_t vertex : candidates) {
+                    if (live[vertex] == 0)
+                        continue;
+                    size_t priority = 0;
+                    if (time - stamps[vertex] + 2 * live[vertex] <= cacheSize)
+                        priority = time - stamps[vertex];
+                    if (focus < 0 || priority > bestPriority) {
+                        focus = vertex;
+                        bestPriority = priority;
+                    }
+                }
+
+                //Out of Neighbours, Backtracks through Recent Vertices, then Scans for any Vertex with Triangles Left
+                while (focus < 0 && !deadEnds.empty()) {
+                    uint32_t vertex = deadEnds.back();
+                    deadEnds.pop_back();
+                    if (live[vertex] > 0)
+                        focus = vertex;
+                }
+                while (focus < 0 && scan < vertexCount) {
+                    if (live[scan] > 0)
+                        focus = static_cast<int64_t>(scan);
+                    ++scan;
+                }
+            }
+
+            for (size_t i = 0; i < result.size(); ++i)
+                indices[i] = vertices[result[i]];
+        }
+
+        /**
+         * @brief FetchRemap - Orders Vertices by their First Use, so the Vertex Fetch Reads Memory Sequentially
+         *
+         * @param Indices : The Triangle List, in Draw Order
+         * @param VertexCount : The Number of Vertices
+         * @return : The New Position of each Vertex, Unused Vertices go Last in their Old Order
+         */
+        static std::vector<uint32_t> FetchRemap(const std::vector<uint32_t>& indices, size_t vertexCount) {
+            const uint32_t UNUSED = UINT32_MAX;
+            std::vector<uint32_t> remap(vertexCount, UNUSED);
+            uint32_t next = 0;
+            for (uint32_t index : indices) {
+                if (remap[index] == UNUSED)
+                    remap[index] = next++;
+            }
+            for (uint32_t& position : remap) {
+                if (position == UNUSED)
+                    position = next++;
+            }
+            return remap;
+        }
+    };
+}